@@ -0,0 +1,160 @@
+// Copyright 2020-2023 Solar Storm Interactive
+
+#include "File/RyCompiledFileFilter.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FRyCompiledFileFilter::FRyCompiledFileFilter(const FRyFileFilterSpec& spec)
+	: MinSize(spec.MinSize)
+	, MaxSize(spec.MaxSize)
+	, ModifiedAfterTicks(spec.ModifiedAfter.GetTicks())
+	, ModifiedBeforeTicks(spec.ModifiedBefore.GetTicks())
+	, CaseSensitive(spec.CaseSensitive)
+{
+	CompilePatterns(spec.IncludePatterns, IncludePatterns);
+	CompilePatterns(spec.ExcludePatterns, ExcludePatterns);
+	CompilePatterns(spec.ExcludeDirectories, ExcludeDirectories);
+
+	for(const FString& extension : spec.Extensions)
+	{
+		FString trimmed = extension.TrimStartAndEnd();
+		trimmed.RemoveFromStart(TEXT("."));
+		if(!trimmed.IsEmpty())
+		{
+			Extensions.Add(MoveTemp(trimmed));
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void FRyCompiledFileFilter::CompilePatterns(const TArray<FString>& patterns, TArray<FPattern>& compiledOut)
+{
+	for(const FString& pattern : patterns)
+	{
+		FPattern compiled;
+		compiled.Glob = pattern.TrimStartAndEnd().Replace(TEXT("\\"), TEXT("/"));
+		compiled.Glob.RemoveFromStart(TEXT("/"));
+		compiled.Glob.RemoveFromEnd(TEXT("/"));
+		if(compiled.Glob.IsEmpty())
+		{
+			continue;
+		}
+		compiled.MatchPath = compiled.Glob.Contains(TEXT("/"));
+		compiledOut.Add(MoveTemp(compiled));
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool FRyCompiledFileFilter::MatchGlob(const FStringView pattern, const FStringView text, const bool caseSensitive)
+{
+	auto charsEqual = [caseSensitive](const TCHAR a, const TCHAR b)
+	{
+		return caseSensitive ? a == b : FChar::ToLower(a) == FChar::ToLower(b);
+	};
+
+	// Greedy match which backtracks to the last * on a mismatch, linear for patterns with a single *
+	int32 patternIndex = 0;
+	int32 textIndex = 0;
+	int32 starIndex = INDEX_NONE;
+	int32 starTextIndex = 0;
+	while(textIndex < text.Len())
+	{
+		if(patternIndex < pattern.Len() && (pattern[patternIndex] == TEXT('?') || (pattern[patternIndex] != TEXT('*') && charsEqual(pattern[patternIndex], text[textIndex]))))
+		{
+			++patternIndex;
+			++textIndex;
+		}
+		else if(patternIndex < pattern.Len() && pattern[patternIndex] == TEXT('*'))
+		{
+			starIndex = patternIndex++;
+			starTextIndex = textIndex;
+		}
+		else if(starIndex != INDEX_NONE)
+		{
+			patternIndex = starIndex + 1;
+			textIndex = ++starTextIndex;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	while(patternIndex < pattern.Len() && pattern[patternIndex] == TEXT('*'))
+	{
+		++patternIndex;
+	}
+	return patternIndex == pattern.Len();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool FRyCompiledFileFilter::MatchesAny(const TArray<FPattern>& patterns, const FStringView relativePath, const FStringView name) const
+{
+	for(const FPattern& pattern : patterns)
+	{
+		if(MatchGlob(pattern.Glob, pattern.MatchPath ? relativePath : name, CaseSensitive))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool FRyCompiledFileFilter::MatchesFile(const FStringView relativePath, const FStringView name, const FFileStatData& statData) const
+{
+	if(statData.FileSize < MinSize || (MaxSize >= 0 && statData.FileSize > MaxSize))
+	{
+		return false;
+	}
+
+	const int64 modifiedTicks = statData.ModificationTime.GetTicks();
+	if((ModifiedAfterTicks > 0 && modifiedTicks < ModifiedAfterTicks) || (ModifiedBeforeTicks > 0 && modifiedTicks > ModifiedBeforeTicks))
+	{
+		return false;
+	}
+
+	if(Extensions.Num() > 0)
+	{
+		int32 dotIndex = INDEX_NONE;
+		if(!name.FindLastChar(TEXT('.'), dotIndex))
+		{
+			return false;
+		}
+		const FStringView extension = name.RightChop(dotIndex + 1);
+		const ESearchCase::Type searchCase = CaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase;
+		const bool extensionMatched = Extensions.ContainsByPredicate([&extension, searchCase](const FString& allowed)
+		{
+			return extension.Equals(allowed, searchCase);
+		});
+		if(!extensionMatched)
+		{
+			return false;
+		}
+	}
+
+	if(IncludePatterns.Num() > 0 && !MatchesAny(IncludePatterns, relativePath, name))
+	{
+		return false;
+	}
+
+	return !MatchesAny(ExcludePatterns, relativePath, name);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool FRyCompiledFileFilter::IsDirectoryExcluded(const FStringView relativePath, const FStringView name) const
+{
+	return MatchesAny(ExcludeDirectories, relativePath, name);
+}
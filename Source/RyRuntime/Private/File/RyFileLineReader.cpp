@@ -0,0 +1,171 @@
+// Copyright 2020-2023 Solar Storm Interactive
+
+#include "File/RyFileLineReader.h"
+#include "RyRuntimeModule.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FRyFileLineReader::FRyFileLineReader(const FString& filePath, const int32 bufferSize)
+	: FileHandle(nullptr)
+	, FileSize(0)
+	, FileOffset(0)
+	, LineNumber(0)
+	, Failed(false)
+	, BufferStart(0)
+	, BufferEnd(0)
+{
+	FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenRead(*filePath);
+	if(!FileHandle)
+	{
+		return;
+	}
+
+	FileSize = FileHandle->Size();
+	Buffer.SetNumUninitialized(FMath::Max(bufferSize, 256));
+	if(!FillBuffer())
+	{
+		return;
+	}
+
+	const uint8* bytes = Buffer.GetData();
+	const int32 numBytes = BufferEnd - BufferStart;
+	if(numBytes >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
+	{
+		BufferStart += 3;
+	}
+	else if(numBytes >= 2 && ((bytes[0] == 0xFF && bytes[1] == 0xFE) || (bytes[0] == 0xFE && bytes[1] == 0xFF)))
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("FRyFileLineReader: %s is UTF-16 which is not supported"), *filePath);
+		Failed = true;
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FRyFileLineReader::~FRyFileLineReader()
+{
+	if(FileHandle)
+	{
+		delete FileHandle;
+		FileHandle = nullptr;
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool FRyFileLineReader::FillBuffer()
+{
+	if(FileOffset >= FileSize)
+	{
+		return false;
+	}
+
+	const int32 numUnread = BufferEnd - BufferStart;
+	if(BufferStart > 0 && numUnread > 0)
+	{
+		FMemory::Memmove(Buffer.GetData(), Buffer.GetData() + BufferStart, numUnread);
+	}
+	BufferStart = 0;
+	BufferEnd = numUnread;
+
+	// The whole buffer is one unfinished line, make room for more of it
+	if(BufferEnd == Buffer.Num())
+	{
+		Buffer.SetNumUninitialized(Buffer.Num() * 2);
+	}
+
+	const int64 numToRead = FMath::Min<int64>(Buffer.Num() - BufferEnd, FileSize - FileOffset);
+	if(!FileHandle->Read(Buffer.GetData() + BufferEnd, numToRead))
+	{
+		Failed = true;
+		return false;
+	}
+
+	FileOffset += numToRead;
+	BufferEnd += static_cast<int32>(numToRead);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool FRyFileLineReader::ReadLineUtf8(TArrayView<const uint8>& lineOut)
+{
+	if(!IsValid())
+	{
+		return false;
+	}
+
+	int32 searchFrom = BufferStart;
+	for(;;)
+	{
+		const uint8* lineStart = Buffer.GetData() + BufferStart;
+		const void* newLine = memchr(Buffer.GetData() + searchFrom, '\n', BufferEnd - searchFrom);
+		int32 lineLength = 0;
+		int32 consumed = 0;
+		if(newLine)
+		{
+			lineLength = static_cast<int32>(static_cast<const uint8*>(newLine) - lineStart);
+			consumed = lineLength + 1;
+		}
+		else
+		{
+			// Not a full line yet, read more unless this is the end of the file
+			const int32 numUnread = BufferEnd - BufferStart;
+			if(FillBuffer())
+			{
+				searchFrom = BufferStart + numUnread;
+				continue;
+			}
+			if(Failed || numUnread == 0)
+			{
+				return false;
+			}
+			lineLength = numUnread;
+			consumed = numUnread;
+		}
+
+		if(lineLength > 0 && lineStart[lineLength - 1] == '\r')
+		{
+			--lineLength;
+		}
+
+		lineOut = TArrayView<const uint8>(lineStart, lineLength);
+		BufferStart += consumed;
+		++LineNumber;
+		return true;
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool FRyFileLineReader::ReadLine(FStringView& lineOut)
+{
+	TArrayView<const uint8> lineBytes;
+	if(!ReadLineUtf8(lineBytes))
+	{
+		return false;
+	}
+
+	// Converted straight into LineChars, which only ever grows, so reading lines stops allocating once the longest
+	// line has been seen
+	const UTF8CHAR* utf8Chars = reinterpret_cast<const UTF8CHAR*>(lineBytes.GetData());
+	const int32 numChars = FPlatformString::ConvertedLength<TCHAR>(utf8Chars, lineBytes.Num());
+	if(LineChars.Num() < numChars)
+	{
+		LineChars.SetNumUninitialized(numChars);
+	}
+	if(numChars > 0)
+	{
+		FPlatformString::Convert(LineChars.GetData(), numChars, utf8Chars, lineBytes.Num());
+	}
+
+	lineOut = FStringView(LineChars.GetData(), numChars);
+	return true;
+}
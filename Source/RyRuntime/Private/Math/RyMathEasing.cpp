@@ -211,3 +211,20 @@ FRotator URyMathEasing::EaseRotator(const ERyMathEasingType easing, const FRotat
     const FRotator DeltaMove = Delta * URyMathEasing::EaseFloat(easing, alpha);
     return (start + DeltaMove).GetNormalized();
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FRotator URyMathEasing::EaseRotatorSlerp(const ERyMathEasingType easing, const FRotator& start, const FRotator& target, const float alpha)
+{
+	if(alpha == 0.0f)
+	{
+		return start;
+	}
+	if(alpha == 1.0f)
+	{
+		return target;
+	}
+
+	return FQuat::Slerp(start.Quaternion(), target.Quaternion(), URyMathEasing::EaseFloat(easing, alpha)).Rotator();
+}
@@ -0,0 +1,352 @@
+// Copyright 2020-2023 Solar Storm Interactive
+
+#include "Profiling/RyFrameTimeSubsystem.h"
+#include "RyRuntimeModule.h"
+#include "Engine/Engine.h"
+#include "RenderCore.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void FRyLogHistogram::Reset()
+{
+	FMemory::Memzero(Counts);
+	TotalCount = 0;
+	TotalUs = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 FRyLogHistogram::GetBucketIndex(uint32 valueUs)
+{
+	valueUs = FMath::Min<uint32>(valueUs, (1u << (MaxExponent + 1)) - 1);
+	if(valueUs < 2 * SubBucketCount)
+	{
+		return static_cast<int32>(valueUs);
+	}
+	const uint32 exponent = FMath::FloorLog2(valueUs);
+	const uint32 shift = exponent - SubBucketBits;
+	return static_cast<int32>(shift * SubBucketCount + (valueUs >> shift));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+uint32 FRyLogHistogram::GetBucketLowerUs(const int32 bucketIndex)
+{
+	if(bucketIndex < 2 * static_cast<int32>(SubBucketCount))
+	{
+		return static_cast<uint32>(bucketIndex);
+	}
+	const uint32 shift = static_cast<uint32>(bucketIndex) / SubBucketCount - 1;
+	const uint32 mantissa = static_cast<uint32>(bucketIndex) % SubBucketCount + SubBucketCount;
+	return mantissa << shift;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+uint32 FRyLogHistogram::GetBucketWidthUs(const int32 bucketIndex)
+{
+	if(bucketIndex < 2 * static_cast<int32>(SubBucketCount))
+	{
+		return 1;
+	}
+	return 1u << (static_cast<uint32>(bucketIndex) / SubBucketCount - 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+double FRyLogHistogram::GetPercentileUs(const float percentile) const
+{
+	if(TotalCount == 0)
+	{
+		return 0.0;
+	}
+
+	const uint64 rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(percentile, 0.0f, 100.0f) / 100.0 * TotalCount)));
+	uint64 seen = 0;
+	for(int32 bucketIndex = 0; bucketIndex < NumBuckets; ++bucketIndex)
+	{
+		seen += Counts[bucketIndex];
+		if(seen >= rank)
+		{
+			return GetBucketLowerUs(bucketIndex) + GetBucketWidthUs(bucketIndex) * 0.5;
+		}
+	}
+	return GetMaxUs();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+double FRyLogHistogram::GetMaxUs() const
+{
+	for(int32 bucketIndex = NumBuckets - 1; bucketIndex >= 0; --bucketIndex)
+	{
+		if(Counts[bucketIndex] > 0)
+		{
+			return GetBucketLowerUs(bucketIndex) + GetBucketWidthUs(bucketIndex) * 0.5;
+		}
+	}
+	return 0.0;
+}
+
+static FAutoConsoleCommand GRyFrameTimesDumpCsvCommand(
+	TEXT("Ry.FrameTimes.DumpCsv"),
+	TEXT("Write the frame time stats and histograms to a CSV file. Optional argument: the file path."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if(URyFrameTimeSubsystem* subsystem = URyFrameTimeSubsystem::Get())
+		{
+			subsystem->DumpCsv(Args.Num() > 0 ? Args[0] : FString());
+		}
+	}));
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyFrameTimeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SetRollingWindowFrames(RollingWindowFrames);
+
+	FString csvPath;
+	if(FParse::Value(FCommandLine::Get(), TEXT("RyFrameTimesCsv="), csvPath))
+	{
+		SetDumpCsvOnShutdown(true, csvPath);
+	}
+	else if(FParse::Param(FCommandLine::Get(), TEXT("RyFrameTimesCsv")))
+	{
+		SetDumpCsvOnShutdown(true, FString());
+	}
+
+#if ENGINE_MAJOR_VERSION > 4
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &URyFrameTimeSubsystem::Tick));
+#else
+	TickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &URyFrameTimeSubsystem::Tick));
+#endif
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyFrameTimeSubsystem::Deinitialize()
+{
+#if ENGINE_MAJOR_VERSION > 4
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+#else
+	FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+#endif
+
+	if(DumpOnShutdown)
+	{
+		DumpCsv(ShutdownCsvPath);
+	}
+
+	Super::Deinitialize();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+URyFrameTimeSubsystem* URyFrameTimeSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<URyFrameTimeSubsystem>() : nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyFrameTimeSubsystem::Tick(float DeltaTime)
+{
+	const double frameSeconds = FApp::GetDeltaTime();
+
+	// Servers without a viewport never set GGameThreadTime, use the frame minus the time spent idling instead
+	double gameThreadSeconds = FPlatformTime::ToSeconds(GGameThreadTime);
+	if(gameThreadSeconds <= 0.0)
+	{
+		gameThreadSeconds = FMath::Max(0.0, frameSeconds - FApp::GetIdleTime());
+	}
+
+	FFrameSample sample;
+	sample.TimesUs[static_cast<int32>(ERyFrameTimeMetric::Frame)] = static_cast<uint32>(frameSeconds * 1000000.0);
+	sample.TimesUs[static_cast<int32>(ERyFrameTimeMetric::GameThread)] = static_cast<uint32>(gameThreadSeconds * 1000000.0);
+	sample.TimesUs[static_cast<int32>(ERyFrameTimeMetric::RenderThread)] = RecordRenderThread ? static_cast<uint32>(FPlatformTime::ToSeconds(GRenderThreadTime) * 1000000.0) : 0;
+	sample.IsHitch = sample.TimesUs[static_cast<int32>(ERyFrameTimeMetric::Frame)] >= HitchThresholdUs;
+	RecordFrame(sample);
+
+	if(sample.IsHitch)
+	{
+		OnHitch.Broadcast(sample.TimesUs[0] / 1000.0f, sample.TimesUs[1] / 1000.0f, sample.TimesUs[2] / 1000.0f);
+	}
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyFrameTimeSubsystem::RecordFrame(const FFrameSample& sample)
+{
+	// Age the oldest frame out of the rolling window once it is full
+	if(RollingFrames.Num() == RollingWindowFrames)
+	{
+		const FFrameSample& oldest = RollingFrames[RollingNext];
+		for(int32 metricIndex = 0; metricIndex < NumMetrics; ++metricIndex)
+		{
+			RollingHistograms[metricIndex].Remove(oldest.TimesUs[metricIndex]);
+		}
+		RollingHitches -= oldest.IsHitch ? 1 : 0;
+		RollingFrames[RollingNext] = sample;
+	}
+	else
+	{
+		RollingFrames.Add(sample);
+	}
+	RollingNext = (RollingNext + 1) % RollingWindowFrames;
+
+	for(int32 metricIndex = 0; metricIndex < NumMetrics; ++metricIndex)
+	{
+		TotalHistograms[metricIndex].Add(sample.TimesUs[metricIndex]);
+		RollingHistograms[metricIndex].Add(sample.TimesUs[metricIndex]);
+	}
+	TotalHitches += sample.IsHitch ? 1 : 0;
+	RollingHitches += sample.IsHitch ? 1 : 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+float URyFrameTimeSubsystem::GetFrameTimePercentile(const ERyFrameTimeMetric metric, const float percentile, const bool rollingWindow) const
+{
+	const FRyLogHistogram& histogram = rollingWindow ? RollingHistograms[static_cast<int32>(metric)] : TotalHistograms[static_cast<int32>(metric)];
+	return static_cast<float>(histogram.GetPercentileUs(percentile) / 1000.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FRyFrameTimeStats URyFrameTimeSubsystem::GetFrameTimeStats(const ERyFrameTimeMetric metric, const bool rollingWindow) const
+{
+	const FRyLogHistogram& histogram = rollingWindow ? RollingHistograms[static_cast<int32>(metric)] : TotalHistograms[static_cast<int32>(metric)];
+	FRyFrameTimeStats stats;
+	stats.NumFrames = static_cast<int32>(histogram.GetCount());
+	stats.Average = static_cast<float>(histogram.GetAverageUs() / 1000.0);
+	stats.P50 = static_cast<float>(histogram.GetPercentileUs(50.0f) / 1000.0);
+	stats.P95 = static_cast<float>(histogram.GetPercentileUs(95.0f) / 1000.0);
+	stats.P99 = static_cast<float>(histogram.GetPercentileUs(99.0f) / 1000.0);
+	stats.Max = static_cast<float>(histogram.GetMaxUs() / 1000.0);
+	stats.NumHitches = rollingWindow ? RollingHitches : TotalHitches;
+	return stats;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyFrameTimeSubsystem::SetRollingWindowFrames(const int32 numFrames)
+{
+	RollingWindowFrames = FMath::Max(numFrames, 1);
+	RollingFrames.Reset();
+	RollingFrames.Reserve(RollingWindowFrames);
+	RollingNext = 0;
+	RollingHitches = 0;
+	for(FRyLogHistogram& histogram : RollingHistograms)
+	{
+		histogram.Reset();
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyFrameTimeSubsystem::SetHitchThreshold(const float milliseconds)
+{
+	HitchThresholdUs = static_cast<uint32>(FMath::Max(milliseconds, 0.0f) * 1000.0f);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyFrameTimeSubsystem::SetRecordRenderThread(const bool record)
+{
+	RecordRenderThread = record;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyFrameTimeSubsystem::Reset()
+{
+	for(FRyLogHistogram& histogram : TotalHistograms)
+	{
+		histogram.Reset();
+	}
+	TotalHitches = 0;
+	SetRollingWindowFrames(RollingWindowFrames);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyFrameTimeSubsystem::SetDumpCsvOnShutdown(const bool dump, const FString& filePath)
+{
+	DumpOnShutdown = dump;
+	ShutdownCsvPath = filePath;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyFrameTimeSubsystem::DumpCsv(const FString& filePath)
+{
+	static const TCHAR* MetricNames[NumMetrics] = { TEXT("Frame"), TEXT("GameThread"), TEXT("RenderThread") };
+
+	const FString csvPath = filePath.IsEmpty()
+		? FPaths::ProfilingDir() / FString::Printf(TEXT("RyFrameTimes-%s.csv"), *FDateTime::Now().ToString())
+		: filePath;
+
+	FString csv = TEXT("Metric,Range,Frames,AverageMs,P50Ms,P90Ms,P95Ms,P99Ms,MaxMs,Hitches\n");
+	for(int32 metricIndex = 0; metricIndex < NumMetrics; ++metricIndex)
+	{
+		for(const bool rolling : { false, true })
+		{
+			const FRyLogHistogram& histogram = rolling ? RollingHistograms[metricIndex] : TotalHistograms[metricIndex];
+			csv += FString::Printf(TEXT("%s,%s,%llu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d\n"), MetricNames[metricIndex], rolling ? TEXT("Rolling") : TEXT("Total"),
+			                       histogram.GetCount(), histogram.GetAverageUs() / 1000.0, histogram.GetPercentileUs(50.0f) / 1000.0,
+			                       histogram.GetPercentileUs(90.0f) / 1000.0, histogram.GetPercentileUs(95.0f) / 1000.0,
+			                       histogram.GetPercentileUs(99.0f) / 1000.0, histogram.GetMaxUs() / 1000.0, rolling ? RollingHitches : TotalHitches);
+		}
+	}
+
+	// Non empty buckets of the whole run
+	csv += TEXT("\nBucketLowerMs,BucketUpperMs,FrameCount,GameThreadCount,RenderThreadCount\n");
+	for(int32 bucketIndex = 0; bucketIndex < FRyLogHistogram::NumBuckets; ++bucketIndex)
+	{
+		const uint32 frameCount = TotalHistograms[0].GetBucketCount(bucketIndex);
+		const uint32 gameCount = TotalHistograms[1].GetBucketCount(bucketIndex);
+		const uint32 renderCount = TotalHistograms[2].GetBucketCount(bucketIndex);
+		if(frameCount + gameCount + renderCount == 0)
+		{
+			continue;
+		}
+		const uint32 lowerUs = FRyLogHistogram::GetBucketLowerUs(bucketIndex);
+		csv += FString::Printf(TEXT("%.3f,%.3f,%u,%u,%u\n"), lowerUs / 1000.0, (lowerUs + FRyLogHistogram::GetBucketWidthUs(bucketIndex)) / 1000.0,
+		                       frameCount, gameCount, renderCount);
+	}
+
+	if(!FFileHelper::SaveStringToFile(csv, *csvPath))
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("URyFrameTimeSubsystem: Couldn't write %s"), *csvPath);
+		return false;
+	}
+	UE_LOG(LogRyRuntime, Log, TEXT("URyFrameTimeSubsystem: Wrote frame times to %s"), *csvPath);
+	return true;
+}
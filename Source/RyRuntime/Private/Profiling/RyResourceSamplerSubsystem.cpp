@@ -0,0 +1,348 @@
+// Copyright 2020-2023 Solar Storm Interactive
+
+#include "Profiling/RyResourceSamplerSubsystem.h"
+#include "RyRuntimeModule.h"
+#include "Engine/Engine.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Background thread which samples resource usage into a single producer ring buffer.
+ * Each slot is a seqlock: the sampler makes the sequence odd while writing and even once done, readers copy the values
+ * and only keep them if the sequence was even and unchanged across the copy. Readers never block the sampler.
+ */
+class FRyResourceSampler : public FRunnable
+{
+public:
+
+	static constexpr int32 NumMetrics = static_cast<int32>(ERyResourceMetric::DiskFree) + 1;
+
+	struct FSampleValues
+	{
+		double Seconds = 0.0;
+		int64 Values[NumMetrics] = {};
+	};
+
+	FRyResourceSampler(const float intervalSeconds, const int32 maxSamples, const FString& diskPath)
+		: IntervalMs(FMath::Max(1, FMath::RoundToInt(intervalSeconds * 1000.0f)))
+		, Capacity(FMath::Max(maxSamples, 2))
+		, Slots(new FSlot[Capacity])
+		, DiskPath(diskPath.IsEmpty() ? FPaths::ProjectSavedDir() : diskPath)
+		, StartSeconds(FPlatformTime::Seconds())
+		, WakeEvent(FPlatformProcess::GetSynchEventFromPool())
+		, Thread(nullptr)
+	{
+		DiskPath = FPaths::ConvertRelativePathToFull(DiskPath);
+		if(FPlatformProcess::SupportsMultithreading())
+		{
+			Thread = FRunnableThread::Create(this, TEXT("RyResourceSampler"), 0, TPri_BelowNormal);
+		}
+		else
+		{
+			UE_LOG(LogRyRuntime, Warning, TEXT("FRyResourceSampler: Multithreading isn't supported, taking a single sample"));
+			TakeSample();
+		}
+	}
+
+	virtual ~FRyResourceSampler() override
+	{
+		StopThread();
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		delete[] Slots;
+	}
+
+	virtual uint32 Run() override
+	{
+		while(!StopRequested)
+		{
+			TakeSample();
+			WakeEvent->Wait(IntervalMs);
+		}
+		return 0;
+	}
+
+	void StopThread()
+	{
+		if(FRunnableThread* thread = Thread)
+		{
+			StopRequested = true;
+			WakeEvent->Trigger();
+			thread->WaitForCompletion();
+			Thread = nullptr;
+			delete thread;
+		}
+	}
+
+	bool IsRunning() const { return Thread != nullptr; }
+
+	/**
+	 * Copy out the samples taken within windowSeconds of the newest one, newest first.
+	 * Stops early at the first slot the sampler has started overwriting since the read began.
+	 */
+	void ReadSamples(const double windowSeconds, TArray<FSampleValues>& samplesOut, const int32 maxSamples = MAX_int32) const
+	{
+		samplesOut.Reset();
+		const uint64 numWritten = NumWritten.load(std::memory_order_acquire);
+		const uint64 numAvailable = FMath::Min<uint64>(numWritten, Capacity);
+		double oldestSeconds = -DBL_MAX;
+
+		for(uint64 age = 0; age < numAvailable && samplesOut.Num() < maxSamples; ++age)
+		{
+			const uint64 sampleIndex = numWritten - 1 - age;
+			const FSlot& slot = Slots[sampleIndex % Capacity];
+
+			const uint64 sequence = slot.Sequence.load(std::memory_order_acquire);
+			FSampleValues values;
+			values.Seconds = slot.Seconds.load(std::memory_order_relaxed);
+			for(int32 metricIndex = 0; metricIndex < NumMetrics; ++metricIndex)
+			{
+				values.Values[metricIndex] = slot.Values[metricIndex].load(std::memory_order_relaxed);
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if(sequence != 2 * sampleIndex + 2 || slot.Sequence.load(std::memory_order_relaxed) != sequence)
+			{
+				// The sampler lapped the reader, every older slot is being overwritten too
+				break;
+			}
+
+			if(age == 0 && windowSeconds > 0.0)
+			{
+				oldestSeconds = values.Seconds - windowSeconds;
+			}
+			if(values.Seconds < oldestSeconds)
+			{
+				break;
+			}
+			samplesOut.Add(values);
+		}
+	}
+
+private:
+
+	struct FSlot
+	{
+		std::atomic<uint64> Sequence{0};
+		std::atomic<double> Seconds{0.0};
+		std::atomic<int64> Values[NumMetrics] = {};
+	};
+
+	void TakeSample()
+	{
+		const FPlatformMemoryStats memoryStats = FPlatformMemory::GetStats();
+		int64 values[NumMetrics];
+		values[static_cast<int32>(ERyResourceMetric::UsedPhysical)] = static_cast<int64>(memoryStats.UsedPhysical);
+		values[static_cast<int32>(ERyResourceMetric::PeakUsedPhysical)] = static_cast<int64>(memoryStats.PeakUsedPhysical);
+		values[static_cast<int32>(ERyResourceMetric::UsedVirtual)] = static_cast<int64>(memoryStats.UsedVirtual);
+		values[static_cast<int32>(ERyResourceMetric::PeakUsedVirtual)] = static_cast<int64>(memoryStats.PeakUsedVirtual);
+		values[static_cast<int32>(ERyResourceMetric::AvailablePhysical)] = static_cast<int64>(memoryStats.AvailablePhysical);
+		// Stored in hundredths of a percent so every value fits the same int64 slot
+		values[static_cast<int32>(ERyResourceMetric::ProcessCpu)] = FMath::RoundToInt(FPlatformTime::GetCPUTime().CPUTimePct * 100.0f);
+
+		uint64 totalBytes = 0;
+		uint64 freeBytes = 0;
+		FPlatformMisc::GetDiskTotalAndFreeSpace(DiskPath, totalBytes, freeBytes);
+		values[static_cast<int32>(ERyResourceMetric::DiskFree)] = static_cast<int64>(freeBytes);
+
+		const uint64 sampleIndex = NumWritten.load(std::memory_order_relaxed);
+		FSlot& slot = Slots[sampleIndex % Capacity];
+		slot.Sequence.store(2 * sampleIndex + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		slot.Seconds.store(FPlatformTime::Seconds() - StartSeconds, std::memory_order_relaxed);
+		for(int32 metricIndex = 0; metricIndex < NumMetrics; ++metricIndex)
+		{
+			slot.Values[metricIndex].store(values[metricIndex], std::memory_order_relaxed);
+		}
+		slot.Sequence.store(2 * sampleIndex + 2, std::memory_order_release);
+		NumWritten.store(sampleIndex + 1, std::memory_order_release);
+	}
+
+	const uint32 IntervalMs;
+	const uint32 Capacity;
+	FSlot* Slots;
+	std::atomic<uint64> NumWritten{0};
+	FString DiskPath;
+	const double StartSeconds;
+	FEvent* WakeEvent;
+	FRunnableThread* Thread;
+	FThreadSafeBool StopRequested;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+static FRyResourceSample RyToResourceSample(const FRyResourceSampler::FSampleValues& values)
+{
+	FRyResourceSample sample;
+	sample.Seconds = static_cast<float>(values.Seconds);
+	sample.UsedPhysical = values.Values[static_cast<int32>(ERyResourceMetric::UsedPhysical)];
+	sample.PeakUsedPhysical = values.Values[static_cast<int32>(ERyResourceMetric::PeakUsedPhysical)];
+	sample.UsedVirtual = values.Values[static_cast<int32>(ERyResourceMetric::UsedVirtual)];
+	sample.PeakUsedVirtual = values.Values[static_cast<int32>(ERyResourceMetric::PeakUsedVirtual)];
+	sample.AvailablePhysical = values.Values[static_cast<int32>(ERyResourceMetric::AvailablePhysical)];
+	sample.ProcessCpu = values.Values[static_cast<int32>(ERyResourceMetric::ProcessCpu)] / 100.0f;
+	sample.DiskFree = values.Values[static_cast<int32>(ERyResourceMetric::DiskFree)];
+	return sample;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyResourceSamplerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	float intervalSeconds = 1.0f;
+	if(FParse::Value(FCommandLine::Get(), TEXT("RyResourceSampler="), intervalSeconds) || FParse::Param(FCommandLine::Get(), TEXT("RyResourceSampler")))
+	{
+		StartSampling(intervalSeconds);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyResourceSamplerSubsystem::Deinitialize()
+{
+	delete Sampler;
+	Sampler = nullptr;
+
+	Super::Deinitialize();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+URyResourceSamplerSubsystem* URyResourceSamplerSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<URyResourceSamplerSubsystem>() : nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyResourceSamplerSubsystem::StartSampling(const float intervalSeconds, const int32 maxSamples, const FString& diskPath)
+{
+	delete Sampler;
+	Sampler = new FRyResourceSampler(intervalSeconds, maxSamples, diskPath);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyResourceSamplerSubsystem::StopSampling()
+{
+	if(Sampler)
+	{
+		Sampler->StopThread();
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyResourceSamplerSubsystem::IsSampling() const
+{
+	return Sampler && Sampler->IsRunning();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyResourceSamplerSubsystem::GetLatestResourceSample(FRyResourceSample& sampleOut) const
+{
+	if(!Sampler)
+	{
+		return false;
+	}
+
+	TArray<FRyResourceSampler::FSampleValues> samples;
+	Sampler->ReadSamples(0.0, samples, 1);
+	if(samples.Num() == 0)
+	{
+		return false;
+	}
+
+	sampleOut = RyToResourceSample(samples[0]);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyResourceSamplerSubsystem::GetResourceSamples(TArray<FRyResourceSample>& samplesOut, const float windowSeconds) const
+{
+	samplesOut.Reset();
+	if(!Sampler)
+	{
+		return;
+	}
+
+	TArray<FRyResourceSampler::FSampleValues> samples;
+	Sampler->ReadSamples(windowSeconds, samples);
+	samplesOut.Reserve(samples.Num());
+	for(int32 sampleIndex = samples.Num() - 1; sampleIndex >= 0; --sampleIndex)
+	{
+		samplesOut.Add(RyToResourceSample(samples[sampleIndex]));
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FRyResourceStats URyResourceSamplerSubsystem::GetResourceStats(const ERyResourceMetric metric, const float windowSeconds) const
+{
+	FRyResourceStats stats;
+	if(!Sampler)
+	{
+		return stats;
+	}
+
+	TArray<FRyResourceSampler::FSampleValues> samples;
+	Sampler->ReadSamples(windowSeconds, samples);
+	if(samples.Num() == 0)
+	{
+		return stats;
+	}
+
+	// CPU is stored in hundredths of a percent, everything else in bytes
+	const double scale = metric == ERyResourceMetric::ProcessCpu ? 0.01 : 1.0 / (1024.0 * 1024.0);
+	const int32 metricIndex = static_cast<int32>(metric);
+
+	double minValue = DBL_MAX;
+	double maxValue = -DBL_MAX;
+	double sumValue = 0.0;
+	double sumHours = 0.0;
+	double sumHoursSquared = 0.0;
+	double sumHoursValue = 0.0;
+	for(const FRyResourceSampler::FSampleValues& sample : samples)
+	{
+		const double value = sample.Values[metricIndex] * scale;
+		const double hours = sample.Seconds / 3600.0;
+		minValue = FMath::Min(minValue, value);
+		maxValue = FMath::Max(maxValue, value);
+		sumValue += value;
+		sumHours += hours;
+		sumHoursSquared += hours * hours;
+		sumHoursValue += hours * value;
+	}
+
+	const double numSamples = samples.Num();
+	stats.NumSamples = samples.Num();
+	stats.Min = static_cast<float>(minValue);
+	stats.Max = static_cast<float>(maxValue);
+	stats.Average = static_cast<float>(sumValue / numSamples);
+	stats.Latest = static_cast<float>(samples[0].Values[metricIndex] * scale);
+
+	const double denominator = numSamples * sumHoursSquared - sumHours * sumHours;
+	if(samples.Num() > 1 && denominator > 0.0)
+	{
+		stats.ChangePerHour = static_cast<float>((numSamples * sumHoursValue - sumHours * sumValue) / denominator);
+	}
+	return stats;
+}
@@ -1,6 +1,482 @@
 ﻿// Copyright 2020-2023 Solar Storm Interactive
 
 #include "RyRuntimeArrayHelpers.h"
+#include "RyRuntimeModule.h"
+#include "Algo/Sort.h"
+#include "Algo/StableSort.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include <type_traits>
+
+// Below this many elements a comparison sort beats the radix sort passes over a scratch buffer
+static constexpr int32 RyRadixSortMinNum = 64;
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+static int32 RyGetElementSize(const FProperty* property)
+{
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) || ENGINE_MAJOR_VERSION > 5
+	return property->GetElementSize() * property->ArrayDim;
+#else
+	return property->ElementSize * property->ArrayDim;
+#endif
+}
+
+// FScriptArray takes the element alignment as well as the size in UE5
+#if ENGINE_MAJOR_VERSION > 4
+#define RY_SCRIPT_ARRAY_ELEMENT_LAYOUT(InnerProp) RyGetElementSize(InnerProp), (InnerProp)->GetMinAlignment()
+#else
+#define RY_SCRIPT_ARRAY_ELEMENT_LAYOUT(InnerProp) RyGetElementSize(InnerProp)
+#endif
+
+/**
+ * Maps a value to an unsigned key which sorts in the same order as the value.
+ * Signed integers flip the sign bit, floats flip the sign bit of positives and every bit of negatives.
+ */
+template<typename T>
+struct TRyRadixKey
+{
+	typedef typename std::make_unsigned<T>::type KeyType;
+	static constexpr KeyType SignFlip = std::is_signed<T>::value ? static_cast<KeyType>(KeyType(1) << (sizeof(T) * 8 - 1)) : KeyType(0);
+
+	static FORCEINLINE KeyType Get(const T value)
+	{
+		return static_cast<KeyType>(static_cast<KeyType>(value) ^ SignFlip);
+	}
+};
+
+template<>
+struct TRyRadixKey<float>
+{
+	typedef uint32 KeyType;
+
+	static FORCEINLINE KeyType Get(const float value)
+	{
+		uint32 bits;
+		FMemory::Memcpy(&bits, &value, sizeof(bits));
+		return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+	}
+};
+
+template<>
+struct TRyRadixKey<double>
+{
+	typedef uint64 KeyType;
+
+	static FORCEINLINE KeyType Get(const double value)
+	{
+		uint64 bits;
+		FMemory::Memcpy(&bits, &value, sizeof(bits));
+		return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+	}
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Stable least significant byte radix sort. Passes where every key shares the same byte are skipped, so small
+ * values in wide types only pay for the bytes which differ.
+ */
+template<typename T>
+static void RyRadixSort(T* data, const int32 num, const bool descending)
+{
+	typedef typename TRyRadixKey<T>::KeyType FKey;
+	const FKey flip = descending ? static_cast<FKey>(~FKey(0)) : FKey(0);
+
+	if(num < RyRadixSortMinNum)
+	{
+		// Equal keys mean identical bits so an unstable sort can't be told apart from a stable one
+		Algo::Sort(TArrayView<T>(data, num), [flip](const T a, const T b)
+		{
+			return static_cast<FKey>(TRyRadixKey<T>::Get(a) ^ flip) < static_cast<FKey>(TRyRadixKey<T>::Get(b) ^ flip);
+		});
+		return;
+	}
+
+	TArray<T> scratch;
+	scratch.SetNumUninitialized(num);
+	T* source = data;
+	T* dest = scratch.GetData();
+
+	for(uint32 shift = 0; shift < sizeof(FKey) * 8; shift += 8)
+	{
+		int32 offsets[256] = {};
+		for(int32 index = 0; index < num; ++index)
+		{
+			++offsets[(static_cast<FKey>(TRyRadixKey<T>::Get(source[index]) ^ flip) >> shift) & 0xFF];
+		}
+
+		// Every key has the same byte here, the pass wouldn't move anything
+		if(offsets[(static_cast<FKey>(TRyRadixKey<T>::Get(source[0]) ^ flip) >> shift) & 0xFF] == num)
+		{
+			continue;
+		}
+
+		int32 total = 0;
+		for(int32& offset : offsets)
+		{
+			const int32 count = offset;
+			offset = total;
+			total += count;
+		}
+
+		for(int32 index = 0; index < num; ++index)
+		{
+			dest[offsets[(static_cast<FKey>(TRyRadixKey<T>::Get(source[index]) ^ flip) >> shift) & 0xFF]++] = source[index];
+		}
+		Swap(source, dest);
+	}
+
+	if(source != data)
+	{
+		FMemory::Memcpy(data, source, num * sizeof(T));
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+template<typename T, typename PredicateType>
+static void RyComparisonSort(void* data, const int32 num, const bool stable, const bool descending, PredicateType lessThan)
+{
+	TArrayView<T> view(static_cast<T*>(data), num);
+	if(descending)
+	{
+		auto greaterThan = [&lessThan](const T& a, const T& b) { return lessThan(b, a); };
+		if(stable)
+		{
+			Algo::StableSort(view, greaterThan);
+		}
+		else
+		{
+			Algo::Sort(view, greaterThan);
+		}
+	}
+	else if(stable)
+	{
+		Algo::StableSort(view, lessThan);
+	}
+	else
+	{
+		Algo::Sort(view, lessThan);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Sort arrays of types which can be ordered without calling into Blueprint.
+ * @return False if the element type has no native ordering
+ */
+static bool RySortNative(void* data, const int32 num, const FProperty* innerProp, const bool stable, const bool descending)
+{
+	if(const FEnumProperty* enumProp = CastField<FEnumProperty>(innerProp))
+	{
+		innerProp = enumProp->GetUnderlyingProperty();
+	}
+
+	if(innerProp->IsA<FByteProperty>()) { RyRadixSort(static_cast<uint8*>(data), num, descending); return true; }
+	if(innerProp->IsA<FInt8Property>()) { RyRadixSort(static_cast<int8*>(data), num, descending); return true; }
+	if(innerProp->IsA<FInt16Property>()) { RyRadixSort(static_cast<int16*>(data), num, descending); return true; }
+	if(innerProp->IsA<FUInt16Property>()) { RyRadixSort(static_cast<uint16*>(data), num, descending); return true; }
+	if(innerProp->IsA<FIntProperty>()) { RyRadixSort(static_cast<int32*>(data), num, descending); return true; }
+	if(innerProp->IsA<FUInt32Property>()) { RyRadixSort(static_cast<uint32*>(data), num, descending); return true; }
+	if(innerProp->IsA<FInt64Property>()) { RyRadixSort(static_cast<int64*>(data), num, descending); return true; }
+	if(innerProp->IsA<FUInt64Property>()) { RyRadixSort(static_cast<uint64*>(data), num, descending); return true; }
+	if(innerProp->IsA<FFloatProperty>()) { RyRadixSort(static_cast<float*>(data), num, descending); return true; }
+	if(innerProp->IsA<FDoubleProperty>()) { RyRadixSort(static_cast<double*>(data), num, descending); return true; }
+
+	if(const FBoolProperty* boolProp = CastField<FBoolProperty>(innerProp))
+	{
+		if(boolProp->IsNativeBool())
+		{
+			RyRadixSort(static_cast<uint8*>(data), num, descending);
+			return true;
+		}
+		return false;
+	}
+
+	// Case insensitive like the Blueprint string comparison nodes
+	if(innerProp->IsA<FStrProperty>())
+	{
+		RyComparisonSort<FString>(data, num, stable, descending, [](const FString& a, const FString& b) { return a < b; });
+		return true;
+	}
+	if(innerProp->IsA<FNameProperty>())
+	{
+		RyComparisonSort<FName>(data, num, stable, descending, [](const FName& a, const FName& b) { return a.LexicalLess(b); });
+		return true;
+	}
+	if(innerProp->IsA<FTextProperty>())
+	{
+		RyComparisonSort<FText>(data, num, stable, descending, [](const FText& a, const FText& b) { return a.CompareTo(b) < 0; });
+		return true;
+	}
+
+	return false;
+}
+
+typedef bool (*RyNativeLessFunc)(const void* a, const void* b);
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Orders values the same way RyRadixSort does, so searches agree with Sort on negative zero and NaN.
+ */
+template<typename T>
+static bool RyRadixKeyLess(const void* a, const void* b)
+{
+	return TRyRadixKey<T>::Get(*static_cast<const T*>(a)) < TRyRadixKey<T>::Get(*static_cast<const T*>(b));
+}
+
+static bool RyStringLess(const void* a, const void* b) { return *static_cast<const FString*>(a) < *static_cast<const FString*>(b); }
+static bool RyNameLess(const void* a, const void* b) { return static_cast<const FName*>(a)->LexicalLess(*static_cast<const FName*>(b)); }
+static bool RyTextLess(const void* a, const void* b) { return static_cast<const FText*>(a)->CompareTo(*static_cast<const FText*>(b)) < 0; }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Get the ordering RySortNative sorts an element type by.
+ * @return Null if the element type has no native ordering
+ */
+static RyNativeLessFunc RyGetNativeLess(const FProperty* innerProp)
+{
+	if(const FEnumProperty* enumProp = CastField<FEnumProperty>(innerProp))
+	{
+		innerProp = enumProp->GetUnderlyingProperty();
+	}
+
+	if(innerProp->IsA<FByteProperty>()) { return &RyRadixKeyLess<uint8>; }
+	if(innerProp->IsA<FInt8Property>()) { return &RyRadixKeyLess<int8>; }
+	if(innerProp->IsA<FInt16Property>()) { return &RyRadixKeyLess<int16>; }
+	if(innerProp->IsA<FUInt16Property>()) { return &RyRadixKeyLess<uint16>; }
+	if(innerProp->IsA<FIntProperty>()) { return &RyRadixKeyLess<int32>; }
+	if(innerProp->IsA<FUInt32Property>()) { return &RyRadixKeyLess<uint32>; }
+	if(innerProp->IsA<FInt64Property>()) { return &RyRadixKeyLess<int64>; }
+	if(innerProp->IsA<FUInt64Property>()) { return &RyRadixKeyLess<uint64>; }
+	if(innerProp->IsA<FFloatProperty>()) { return &RyRadixKeyLess<float>; }
+	if(innerProp->IsA<FDoubleProperty>()) { return &RyRadixKeyLess<double>; }
+	if(const FBoolProperty* boolProp = CastField<FBoolProperty>(innerProp))
+	{
+		return boolProp->IsNativeBool() ? &RyRadixKeyLess<uint8> : nullptr;
+	}
+	if(innerProp->IsA<FStrProperty>()) { return &RyStringLess; }
+	if(innerProp->IsA<FNameProperty>()) { return &RyNameLess; }
+	if(innerProp->IsA<FTextProperty>()) { return &RyTextLess; }
+	return nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Binary search for the first element which doesn't go before item, or with upperBound the first element item goes before.
+ */
+static int32 RyFindBound(FScriptArrayHelper& arrayHelper, const void* item, const RyNativeLessFunc lessThan, const bool descending, const bool upperBound)
+{
+	int32 first = 0;
+	int32 count = arrayHelper.Num();
+	while(count > 0)
+	{
+		const int32 step = count / 2;
+		const void* element = arrayHelper.GetRawPtr(first + step);
+		const bool elementFirst = upperBound
+			? !(descending ? lessThan(element, item) : lessThan(item, element))
+			: (descending ? lessThan(item, element) : lessThan(element, item));
+		if(elementFirst)
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+	return first;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Open addressing hash set of pointers to property values, compared with FProperty::Identical.
+ * The values aren't copied, they must stay where they are and unchanged while the set is used.
+ * Properties without CPF_HasGetValueTypeHash all hash to the same slot chain, correct but O(n^2).
+ * Floats and doubles are hashed with -0 folded into +0, since Identical compares them with == but their hash is of the bits.
+ */
+class FRyPropertyHashSet
+{
+public:
+	FRyPropertyHashSet(const FProperty* property, const int32 expectedNum)
+		: Property(property)
+		, CanHash(property->HasAnyPropertyFlags(CPF_HasGetValueTypeHash))
+		, IsFloat(property->IsA<FFloatProperty>())
+		, IsDouble(property->IsA<FDoubleProperty>())
+		, NumValues(0)
+	{
+		Slots.SetNumZeroed(FMath::RoundUpToPowerOfTwo(FMath::Max(expectedNum * 2, 16)));
+	}
+
+	bool Contains(const void* value) const
+	{
+		return Slots[FindSlot(value, Hash(value))].Value != nullptr;
+	}
+
+	/** @return False if an identical value was already in the set */
+	bool Add(const void* value)
+	{
+		const uint32 hash = Hash(value);
+		int32 slotIndex = FindSlot(value, hash);
+		if(Slots[slotIndex].Value)
+		{
+			return false;
+		}
+
+		if((NumValues + 1) * 2 > Slots.Num())
+		{
+			Grow();
+			slotIndex = FindSlot(value, hash);
+		}
+		Slots[slotIndex].Value = value;
+		Slots[slotIndex].Hash = hash;
+		++NumValues;
+		return true;
+	}
+
+private:
+
+	struct FSlot
+	{
+		const void* Value;
+		uint32 Hash;
+	};
+
+	uint32 Hash(const void* value) const
+	{
+		if(!CanHash)
+		{
+			return 0;
+		}
+
+		uint32 hash = 0;
+		if(IsFloat)
+		{
+			// Checked on the bits, fast float math may assume there is no -0 and fold a compare away
+			uint32 bits;
+			FMemory::Memcpy(&bits, value, sizeof(bits));
+			hash = (bits & 0x7fffffffu) == 0 ? 0 : GetTypeHash(bits);
+		}
+		else if(IsDouble)
+		{
+			uint64 bits;
+			FMemory::Memcpy(&bits, value, sizeof(bits));
+			hash = (bits & 0x7fffffffffffffffull) == 0 ? 0 : GetTypeHash(bits);
+		}
+		else
+		{
+			hash = Property->GetValueTypeHash(value);
+		}
+
+		// Integer hashes are often the value itself, mix the bits so linear probing doesn't cluster
+		hash ^= hash >> 16;
+		hash *= 0x85ebca6bu;
+		hash ^= hash >> 13;
+		hash *= 0xc2b2ae35u;
+		hash ^= hash >> 16;
+		return hash;
+	}
+
+	int32 FindSlot(const void* value, const uint32 hash) const
+	{
+		const int32 mask = Slots.Num() - 1;
+		int32 slotIndex = static_cast<int32>(hash) & mask;
+		while(Slots[slotIndex].Value && (Slots[slotIndex].Hash != hash || !Property->Identical(Slots[slotIndex].Value, value)))
+		{
+			slotIndex = (slotIndex + 1) & mask;
+		}
+		return slotIndex;
+	}
+
+	void Grow()
+	{
+		TArray<FSlot> oldSlots = MoveTemp(Slots);
+		Slots.SetNumZeroed(oldSlots.Num() * 2);
+		const int32 mask = Slots.Num() - 1;
+		for(const FSlot& slot : oldSlots)
+		{
+			if(slot.Value)
+			{
+				int32 slotIndex = static_cast<int32>(slot.Hash) & mask;
+				while(Slots[slotIndex].Value)
+				{
+					slotIndex = (slotIndex + 1) & mask;
+				}
+				Slots[slotIndex] = slot;
+			}
+		}
+	}
+
+	const FProperty* Property;
+	const bool CanHash;
+	const bool IsFloat;
+	const bool IsDouble;
+	int32 NumValues;
+	TArray<FSlot> Slots;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Keep the elements of target which pass keep and aren't already in seen, in order.
+ * In place the kept elements are swapped down over the rejected ones and the tail is removed, so nothing reallocates.
+ * Otherwise the kept elements are copied into result.
+ */
+template<typename KeepFunc>
+static void RyFilterUnique(FScriptArrayHelper& target, FScriptArrayHelper& result, const FProperty* innerProp, FRyPropertyHashSet& seen, const bool inPlace,
+                           KeepFunc keep)
+{
+	const int32 num = target.Num();
+	if(inPlace)
+	{
+		result.EmptyValues();
+		int32 numKept = 0;
+		for(int32 index = 0; index < num; ++index)
+		{
+			const void* element = target.GetRawPtr(index);
+			if(!keep(element) || seen.Contains(element))
+			{
+				continue;
+			}
+			if(numKept != index)
+			{
+				target.SwapValues(numKept, index);
+			}
+			// Kept elements never move again, so the set can point at them
+			seen.Add(target.GetRawPtr(numKept));
+			++numKept;
+		}
+		target.RemoveValues(numKept, num - numKept);
+	}
+	else
+	{
+		result.EmptyValues(num);
+		for(int32 index = 0; index < num; ++index)
+		{
+			const void* element = target.GetRawPtr(index);
+			if(keep(element) && seen.Add(element))
+			{
+				const int32 resultIndex = result.AddValue();
+				innerProp->CopySingleValueToScriptVM(result.GetRawPtr(resultIndex), element);
+			}
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+static bool RyCheckSameElementType(const FArrayProperty* TargetArrayProp, const FArrayProperty* OtherArrayProp, const TCHAR* nodeName)
+{
+	if(!TargetArrayProp->Inner->SameType(OtherArrayProp->Inner))
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("%s: Can't combine %s and %s arrays"), nodeName, *TargetArrayProp->Inner->GetCPPType(), *OtherArrayProp->Inner->GetCPPType());
+		return false;
+	}
+	return true;
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
@@ -87,14 +563,437 @@ bool URyRuntimeArrayHelpers::GenericArray_IsEmpty(const void* TargetArray, const
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
+*/
+void URyRuntimeArrayHelpers::Array_Sort(const TArray<int32>& TargetArray, const FRyGenericArraySort& SortFunc, const bool stable, const bool descending)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+}
 
-void URyRuntimeArrayHelpers::Array_Sort(const TArray<int32>& TargetArray, FRyGenericArraySort SortFunc)
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::GenericArray_Sort(const void* TargetArray, const FArrayProperty* ArrayProp, const FRyGenericArraySort& SortFunc, const bool stable, const bool descending)
+{
+	if( !TargetArray )
+	{
+		return;
+	}
+
+	FScriptArrayHelper ArrayHelper(ArrayProp, TargetArray);
+	const int32 num = ArrayHelper.Num();
+	if(num < 2 || RySortNative(ArrayHelper.GetRawPtr(0), num, ArrayProp->Inner, stable, descending))
+	{
+		return;
+	}
+
+	if(!SortFunc.IsBound())
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("Sort: %s arrays need a SortFunc"), *ArrayProp->Inner->GetCPPType());
+		return;
+	}
+
+	// Sort indices so SortFunc always sees the array in its original order
+	TArray<int32> order;
+	order.SetNumUninitialized(num);
+	for(int32 index = 0; index < num; ++index)
+	{
+		order[index] = index;
+	}
+
+	auto lessThan = [&SortFunc, descending](const int32 a, const int32 b)
+	{
+		return descending ? SortFunc.Execute(b, a) : SortFunc.Execute(a, b);
+	};
+	if(stable)
+	{
+		Algo::StableSort(order, lessThan);
+	}
+	else
+	{
+		Algo::Sort(order, lessThan);
+	}
+
+	// Array elements are bitwise relocatable, move each one into its sorted slot without copy constructing it
+	const int32 elementSize = RyGetElementSize(ArrayProp->Inner);
+	TArray<uint8> scratch;
+	scratch.SetNumUninitialized(num * elementSize);
+	for(int32 index = 0; index < num; ++index)
+	{
+		FMemory::Memcpy(scratch.GetData() + index * elementSize, ArrayHelper.GetRawPtr(order[index]), elementSize);
+	}
+	FMemory::Memcpy(ArrayHelper.GetRawPtr(0), scratch.GetData(), scratch.Num());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeArrayHelpers::Array_BinarySearch(const TArray<int32>& TargetArray, const int32& Item, const bool descending)
 {
 	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
 	check(0);
+	return INDEX_NONE;
 }
-	
-void URyRuntimeArrayHelpers::GenericArray_Sort(const void* TargetArray, const FArrayProperty* ArrayProp, const void* DelegateAddr, const FDelegateProperty* DelegateProperty)
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeArrayHelpers::GenericArray_BinarySearch(const void* TargetArray, const FArrayProperty* ArrayProp, const void* Item, const bool descending)
 {
-	
-}*/
+	if( !TargetArray )
+	{
+		return INDEX_NONE;
+	}
+
+	const RyNativeLessFunc lessThan = RyGetNativeLess(ArrayProp->Inner);
+	if(!lessThan)
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("Binary Search: %s arrays have no native ordering"), *ArrayProp->Inner->GetCPPType());
+		return INDEX_NONE;
+	}
+
+	FScriptArrayHelper ArrayHelper(ArrayProp, TargetArray);
+	const int32 index = RyFindBound(ArrayHelper, Item, lessThan, descending, false);
+	if(index < ArrayHelper.Num())
+	{
+		// The element doesn't go before Item, it's equal unless Item goes before it
+		const void* element = ArrayHelper.GetRawPtr(index);
+		if(!(descending ? lessThan(element, Item) : lessThan(Item, element)))
+		{
+			return index;
+		}
+	}
+	return INDEX_NONE;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeArrayHelpers::Array_LowerBound(const TArray<int32>& TargetArray, const int32& Item, const bool descending)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+	return INDEX_NONE;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeArrayHelpers::GenericArray_LowerBound(const void* TargetArray, const FArrayProperty* ArrayProp, const void* Item, const bool descending)
+{
+	if( !TargetArray )
+	{
+		return INDEX_NONE;
+	}
+
+	const RyNativeLessFunc lessThan = RyGetNativeLess(ArrayProp->Inner);
+	if(!lessThan)
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("Lower Bound: %s arrays have no native ordering"), *ArrayProp->Inner->GetCPPType());
+		return INDEX_NONE;
+	}
+
+	FScriptArrayHelper ArrayHelper(ArrayProp, TargetArray);
+	return RyFindBound(ArrayHelper, Item, lessThan, descending, false);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeArrayHelpers::Array_SortedInsert(const TArray<int32>& TargetArray, const int32& Item, const bool descending)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+	return INDEX_NONE;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeArrayHelpers::GenericArray_SortedInsert(const void* TargetArray, const FArrayProperty* ArrayProp, const void* Item, const bool descending)
+{
+	if( !TargetArray )
+	{
+		return INDEX_NONE;
+	}
+
+	const RyNativeLessFunc lessThan = RyGetNativeLess(ArrayProp->Inner);
+	if(!lessThan)
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("Sorted Insert: %s arrays have no native ordering"), *ArrayProp->Inner->GetCPPType());
+		return INDEX_NONE;
+	}
+
+	FScriptArrayHelper ArrayHelper(ArrayProp, TargetArray);
+	const int32 index = RyFindBound(ArrayHelper, Item, lessThan, descending, true);
+	ArrayHelper.InsertValues(index, 1);
+	ArrayProp->Inner->CopySingleValueToScriptVM(ArrayHelper.GetRawPtr(index), Item);
+	return index;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::Array_Unique(const TArray<int32>& TargetArray, TArray<int32>& Result, const bool inPlace)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::GenericArray_Unique(const void* TargetArray, const FArrayProperty* TargetArrayProp, void* Result, const FArrayProperty* ResultProp, const bool inPlace)
+{
+	if( !TargetArray || !Result )
+	{
+		return;
+	}
+
+	FScriptArrayHelper TargetHelper(TargetArrayProp, TargetArray);
+	FScriptArrayHelper ResultHelper(ResultProp, Result);
+	FRyPropertyHashSet seen(TargetArrayProp->Inner, TargetHelper.Num());
+	RyFilterUnique(TargetHelper, ResultHelper, TargetArrayProp->Inner, seen, inPlace, [](const void*) { return true; });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::Array_Union(const TArray<int32>& TargetArray, const TArray<int32>& OtherArray, TArray<int32>& Result, const bool inPlace)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::GenericArray_Union(const void* TargetArray, const FArrayProperty* TargetArrayProp, const void* OtherArray, const FArrayProperty* OtherArrayProp,
+                                                void* Result, const FArrayProperty* ResultProp, const bool inPlace)
+{
+	if( !TargetArray || !OtherArray || !Result || !RyCheckSameElementType(TargetArrayProp, OtherArrayProp, TEXT("Union")) )
+	{
+		return;
+	}
+
+	const FProperty* InnerProp = TargetArrayProp->Inner;
+	FScriptArrayHelper TargetHelper(TargetArrayProp, TargetArray);
+	FScriptArrayHelper OtherHelper(OtherArrayProp, OtherArray);
+	FScriptArrayHelper ResultHelper(ResultProp, Result);
+	FRyPropertyHashSet seen(InnerProp, TargetHelper.Num() + OtherHelper.Num());
+	RyFilterUnique(TargetHelper, ResultHelper, InnerProp, seen, inPlace, [](const void*) { return true; });
+
+	// Find the new elements before adding any, adding may reallocate the array the set points into
+	TArray<int32> added;
+	for(int32 index = 0; index < OtherHelper.Num(); ++index)
+	{
+		if(seen.Add(OtherHelper.GetRawPtr(index)))
+		{
+			added.Add(index);
+		}
+	}
+
+	FScriptArrayHelper& OutHelper = inPlace ? TargetHelper : ResultHelper;
+	const int32 firstIndex = OutHelper.AddValues(added.Num());
+	for(int32 addedIndex = 0; addedIndex < added.Num(); ++addedIndex)
+	{
+		InnerProp->CopySingleValueToScriptVM(OutHelper.GetRawPtr(firstIndex + addedIndex), OtherHelper.GetRawPtr(added[addedIndex]));
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::Array_Intersect(const TArray<int32>& TargetArray, const TArray<int32>& OtherArray, TArray<int32>& Result, const bool inPlace)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::GenericArray_Intersect(const void* TargetArray, const FArrayProperty* TargetArrayProp, const void* OtherArray, const FArrayProperty* OtherArrayProp,
+                                                    void* Result, const FArrayProperty* ResultProp, const bool inPlace)
+{
+	if( !TargetArray || !OtherArray || !Result || !RyCheckSameElementType(TargetArrayProp, OtherArrayProp, TEXT("Intersect")) )
+	{
+		return;
+	}
+
+	FScriptArrayHelper TargetHelper(TargetArrayProp, TargetArray);
+	FScriptArrayHelper OtherHelper(OtherArrayProp, OtherArray);
+	FScriptArrayHelper ResultHelper(ResultProp, Result);
+
+	// Intersecting an array with itself is Unique, and others can't point into an array which is being reordered
+	if(TargetArray == OtherArray)
+	{
+		GenericArray_Unique(TargetArray, TargetArrayProp, Result, ResultProp, inPlace);
+		return;
+	}
+
+	FRyPropertyHashSet others(TargetArrayProp->Inner, OtherHelper.Num());
+	for(int32 index = 0; index < OtherHelper.Num(); ++index)
+	{
+		others.Add(OtherHelper.GetRawPtr(index));
+	}
+
+	FRyPropertyHashSet seen(TargetArrayProp->Inner, FMath::Min(TargetHelper.Num(), OtherHelper.Num()));
+	RyFilterUnique(TargetHelper, ResultHelper, TargetArrayProp->Inner, seen, inPlace, [&others](const void* element) { return others.Contains(element); });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::Array_Difference(const TArray<int32>& TargetArray, const TArray<int32>& OtherArray, TArray<int32>& Result, const bool inPlace)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::GenericArray_Difference(const void* TargetArray, const FArrayProperty* TargetArrayProp, const void* OtherArray, const FArrayProperty* OtherArrayProp,
+                                                     void* Result, const FArrayProperty* ResultProp, const bool inPlace)
+{
+	if( !TargetArray || !OtherArray || !Result || !RyCheckSameElementType(TargetArrayProp, OtherArrayProp, TEXT("Difference")) )
+	{
+		return;
+	}
+
+	FScriptArrayHelper TargetHelper(TargetArrayProp, TargetArray);
+	FScriptArrayHelper OtherHelper(OtherArrayProp, OtherArray);
+	FScriptArrayHelper ResultHelper(ResultProp, Result);
+
+	// Nothing is left after removing an array from itself
+	if(TargetArray == OtherArray)
+	{
+		ResultHelper.EmptyValues();
+		if(inPlace)
+		{
+			TargetHelper.EmptyValues();
+		}
+		return;
+	}
+
+	FRyPropertyHashSet others(TargetArrayProp->Inner, OtherHelper.Num());
+	for(int32 index = 0; index < OtherHelper.Num(); ++index)
+	{
+		others.Add(OtherHelper.GetRawPtr(index));
+	}
+
+	FRyPropertyHashSet seen(TargetArrayProp->Inner, TargetHelper.Num());
+	RyFilterUnique(TargetHelper, ResultHelper, TargetArrayProp->Inner, seen, inPlace, [&others](const void* element) { return !others.Contains(element); });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::Array_Reserve(const TArray<int32>& TargetArray, const int32 Capacity)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::GenericArray_Reserve(const void* TargetArray, const FArrayProperty* ArrayProp, const int32 Capacity)
+{
+	if( !TargetArray || Capacity <= GenericArray_GetCapacity(TargetArray, ArrayProp) )
+	{
+		return;
+	}
+
+	// FScriptArray can't reserve, so allocate the capacity in a new array and relocate the elements into it bitwise.
+	// MoveAssign frees the old allocation without destructing anything, which is right as the elements have moved.
+	FScriptArray* Array = static_cast<FScriptArray*>(const_cast<void*>(TargetArray));
+	const int32 num = Array->Num();
+	FScriptArray Reserved;
+	Reserved.Empty(Capacity, RY_SCRIPT_ARRAY_ELEMENT_LAYOUT(ArrayProp->Inner));
+	Reserved.Add(num, RY_SCRIPT_ARRAY_ELEMENT_LAYOUT(ArrayProp->Inner));
+	if(num > 0)
+	{
+		FMemory::Memcpy(Reserved.GetData(), Array->GetData(), num * RyGetElementSize(ArrayProp->Inner));
+	}
+	Array->MoveAssign(Reserved, RY_SCRIPT_ARRAY_ELEMENT_LAYOUT(ArrayProp->Inner));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::Array_Shrink(const TArray<int32>& TargetArray)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeArrayHelpers::GenericArray_Shrink(const void* TargetArray, const FArrayProperty* ArrayProp)
+{
+	if( TargetArray )
+	{
+		FScriptArray* Array = static_cast<FScriptArray*>(const_cast<void*>(TargetArray));
+		Array->Shrink(RY_SCRIPT_ARRAY_ELEMENT_LAYOUT(ArrayProp->Inner));
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeArrayHelpers::Array_GetCapacity(const TArray<int32>& TargetArray)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+	return 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeArrayHelpers::GenericArray_GetCapacity(const void* TargetArray, const FArrayProperty* ArrayProp)
+{
+	if( TargetArray )
+	{
+		const FScriptArray* Array = static_cast<const FScriptArray*>(TargetArray);
+		return Array->Num() + Array->GetSlack();
+	}
+
+	return 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeArrayHelpers::Array_RemoveAtSwap(const TArray<int32>& TargetArray, const int32 IndexToRemove)
+{
+	// We should never hit these!  They're stubs to avoid NoExport on the class.  Call the Generic* equivalent instead
+	check(0);
+	return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeArrayHelpers::GenericArray_RemoveAtSwap(const void* TargetArray, const FArrayProperty* ArrayProp, const int32 IndexToRemove)
+{
+	if( TargetArray )
+	{
+		FScriptArrayHelper ArrayHelper(ArrayProp, TargetArray);
+		if(ArrayHelper.IsValidIndex(IndexToRemove))
+		{
+			const int32 lastIndex = ArrayHelper.Num() - 1;
+			if(IndexToRemove != lastIndex)
+			{
+				ArrayHelper.SwapValues(IndexToRemove, lastIndex);
+			}
+			ArrayHelper.RemoveValues(lastIndex, 1);
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -2,12 +2,94 @@
 
 #include "RyRuntimeFileHelpers.h"
 #include "RyRuntimeModule.h"
+#include "File/RyFileLineReader.h"
 #include "HAL/PlatformFileManager.h"
 #include "GenericPlatform/GenericPlatformFile.h"
 #include "GenericPlatform/GenericPlatformApplicationMisc.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/Async.h"
+#include "Async/AsyncFileHandle.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Compression.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/SecureHash.h"
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
+#include "Hash/xxhash.h"
+#endif
+#include "LatentActions.h"
+#include "Engine/Engine.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include "Windows/WindowsHWrapper.h"
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Background thread which periodically flushes the write buffer of a URyFileHandle
+ */
+class FRyFileHandleFlusher : public FRunnable
+{
+public:
+
+	FRyFileHandleFlusher(URyFileHandle* owner, const float interval)
+		: Owner(owner)
+		, IntervalMs(FMath::Max(1, FMath::RoundToInt(interval * 1000.0f)))
+		, WakeEvent(FPlatformProcess::GetSynchEventFromPool())
+		, Thread(nullptr)
+	{
+		Thread = FRunnableThread::Create(this, TEXT("RyFileHandleFlusher"), 0, TPri_BelowNormal);
+	}
+
+	virtual ~FRyFileHandleFlusher() override
+	{
+		StopRequested = true;
+		WakeEvent->Trigger();
+		if(Thread)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+		}
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	}
+
+	virtual uint32 Run() override
+	{
+		bool lastFlushFailed = false;
+		while(!StopRequested)
+		{
+			WakeEvent->Wait(IntervalMs);
+			if(!StopRequested)
+			{
+				FScopeLock lock(&Owner->HandleLock);
+				const bool flushFailed = !Owner->FlushWriteBuffer();
+				// The buffer is kept and retried next interval, only warn when it starts failing
+				if(flushFailed && !lastFlushFailed)
+				{
+					UE_LOG(LogRyRuntime, Warning, TEXT("URyFileHandle: Background flush failed, %d bytes kept in the write buffer"), Owner->WriteBuffer.Num());
+				}
+				lastFlushFailed = flushFailed;
+			}
+		}
+		return 0;
+	}
+
+private:
+	URyFileHandle* Owner;
+	const uint32 IntervalMs;
+	FEvent* WakeEvent;
+	FRunnableThread* Thread;
+	FThreadSafeBool StopRequested;
+};
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
@@ -15,11 +97,7 @@
 void URyFileHandle::BeginDestroy()
 {
 	UObject::BeginDestroy();
-	if(Handle)
-	{
-		delete Handle;
-		Handle = nullptr;
-	}
+	Close();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -27,7 +105,8 @@ void URyFileHandle::BeginDestroy()
 */
 bool URyFileHandle::Seek(const int64 newPosition)
 {
-	if(!Handle)
+	FScopeLock lock(&HandleLock);
+	if(!Handle || !FlushWriteBuffer())
 	{
 		return false;
 	}
@@ -40,7 +119,8 @@ bool URyFileHandle::Seek(const int64 newPosition)
 */
 bool URyFileHandle::SeekFromEnd(const int64 numBytes)
 {
-	if(!Handle)
+	FScopeLock lock(&HandleLock);
+	if(!Handle || !FlushWriteBuffer())
 	{
 		return false;
 	}
@@ -53,12 +133,7 @@ bool URyFileHandle::SeekFromEnd(const int64 numBytes)
 */
 bool URyFileHandle::SeekToStart()
 {
-	if(!Handle)
-	{
-		return false;
-	}
-
-	return Handle->Seek(0);
+	return Seek(0);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -66,12 +141,7 @@ bool URyFileHandle::SeekToStart()
 */
 bool URyFileHandle::SeekToEnd()
 {
-	if(!Handle)
-	{
-		return false;
-	}
-
-	return Handle->SeekFromEnd(0);
+	return SeekFromEnd(0);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -79,7 +149,8 @@ bool URyFileHandle::SeekToEnd()
 */
 bool URyFileHandle::Read(TArray<uint8>& bytesTo, const int64 numBytes)
 {
-	if(!Handle || !CanRead)
+	FScopeLock lock(&HandleLock);
+	if(!Handle || !CanRead || !FlushWriteBuffer())
 	{
 		return false;
 	}
@@ -97,182 +168,2013 @@ bool URyFileHandle::Read(TArray<uint8>& bytesTo, const int64 numBytes)
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-bool URyFileHandle::Write(const TArray<uint8>& bytesOut)
+bool URyFileHandle::ReadRanges(const TArray<int64>& offsets, const TArray<int64>& sizes, TArray<FRyFileReadSlice>& slicesOut, const int64 maxGap)
 {
-	if(!Handle || bytesOut.Num() == 0 || !CanWrite)
+	slicesOut.Reset();
+
+	// Each slice is a TArray, so a range has to fit in one before anything is read
+	for(const int64 size : sizes)
+	{
+		if(size > MAX_int32)
+		{
+			UE_LOG(LogRyRuntime, Warning, TEXT("URyFileHandle::ReadRanges: Range of %lld bytes is too large, use ReadRangesPacked"), size);
+			return false;
+		}
+	}
+
+	TArray64<uint8> bytes;
+	TArray<int64> sliceOffsets;
+	if(!ReadRangesPacked(offsets, sizes, bytes, sliceOffsets, maxGap))
 	{
 		return false;
 	}
 
-	return Handle->Write(bytesOut.GetData(), bytesOut.Num());
+	slicesOut.SetNum(sliceOffsets.Num());
+	for(int32 rangeIndex = 0; rangeIndex < sliceOffsets.Num(); ++rangeIndex)
+	{
+		slicesOut[rangeIndex].Bytes.Append(bytes.GetData() + sliceOffsets[rangeIndex], static_cast<int32>(sizes[rangeIndex]));
+	}
+	return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-int64 URyFileHandle::Size() const
+bool URyFileHandle::ReadRangesPacked(TArrayView<const int64> offsets, TArrayView<const int64> sizes, TArray64<uint8>& bytesOut, TArray<int64>& sliceOffsetsOut, const int64 maxGap)
 {
-	if(!Handle)
+	// Merged reads are capped so a few far apart ranges with a large maxGap don't read most of the file
+	constexpr int64 MaxMergedReadSize = 16 * 1024 * 1024;
+
+	bytesOut.Reset();
+	sliceOffsetsOut.Reset();
+
+	FScopeLock lock(&HandleLock);
+	if(!Handle || !CanRead || offsets.Num() != sizes.Num() || !FlushWriteBuffer())
 	{
-		return 0;
+		return false;
+	}
+
+	const int64 fileSize = Handle->Size();
+	int64 totalBytes = 0;
+	sliceOffsetsOut.SetNumUninitialized(offsets.Num());
+	for(int32 rangeIndex = 0; rangeIndex < offsets.Num(); ++rangeIndex)
+	{
+		if(offsets[rangeIndex] < 0 || sizes[rangeIndex] < 0 || offsets[rangeIndex] + sizes[rangeIndex] > fileSize)
+		{
+			UE_LOG(LogRyRuntime, Warning, TEXT("URyFileHandle::ReadRanges: Range %lld+%lld is outside of the file"), offsets[rangeIndex], sizes[rangeIndex]);
+			sliceOffsetsOut.Reset();
+			return false;
+		}
+		sliceOffsetsOut[rangeIndex] = totalBytes;
+		totalBytes += sizes[rangeIndex];
+	}
+	bytesOut.SetNumUninitialized(totalBytes);
+
+	// Visit the ranges in file order so they can be merged
+	TArray<int32> order;
+	order.SetNumUninitialized(offsets.Num());
+	for(int32 rangeIndex = 0; rangeIndex < order.Num(); ++rangeIndex)
+	{
+		order[rangeIndex] = rangeIndex;
+	}
+	order.Sort([&offsets](const int32 a, const int32 b) { return offsets[a] < offsets[b]; });
+
+	const int64 startPosition = Handle->Tell();
+	TArray64<uint8> readBuffer;
+	bool success = true;
+	int32 groupStart = 0;
+	while(success && groupStart < order.Num())
+	{
+		const int64 readStart = offsets[order[groupStart]];
+		int64 readEnd = readStart + sizes[order[groupStart]];
+		int32 groupEnd = groupStart + 1;
+		for(; groupEnd < order.Num(); ++groupEnd)
+		{
+			const int64 nextStart = offsets[order[groupEnd]];
+			const int64 nextEnd = FMath::Max(readEnd, nextStart + sizes[order[groupEnd]]);
+			if(nextStart > readEnd + maxGap || nextEnd - readStart > MaxMergedReadSize)
+			{
+				break;
+			}
+			readEnd = nextEnd;
+		}
+
+		if(readEnd > readStart)
+		{
+			const int64 readSize = readEnd - readStart;
+			if(readBuffer.Num() < readSize)
+			{
+				readBuffer.SetNumUninitialized(readSize);
+			}
+			success = Handle->Seek(readStart) && Handle->Read(readBuffer.GetData(), readSize);
+			for(int32 groupIndex = groupStart; success && groupIndex < groupEnd; ++groupIndex)
+			{
+				const int32 rangeIndex = order[groupIndex];
+				if(sizes[rangeIndex] > 0)
+				{
+					FMemory::Memcpy(bytesOut.GetData() + sliceOffsetsOut[rangeIndex], readBuffer.GetData() + (offsets[rangeIndex] - readStart), sizes[rangeIndex]);
+				}
+			}
+		}
+		groupStart = groupEnd;
 	}
 
-	return Handle->Size();
+	Handle->Seek(startPosition);
+	if(!success)
+	{
+		bytesOut.Reset();
+		sliceOffsetsOut.Reset();
+	}
+	return success;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-void URyFileHandle::Close()
+bool URyFileHandle::Write(const TArray<uint8>& bytesOut)
 {
-	if(Handle)
-	{
-		delete Handle;
-		Handle = nullptr;
-	}
+	return WriteRaw(bytesOut.GetData(), bytesOut.Num());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-URyFileHandle* URyRuntimeFileHelpers::OpenFileHandle(UObject* outer, const FString filePath, const bool forRead, const bool forWrite, bool& success)
+bool URyFileHandle::WriteRaw(const uint8* bytesOut, const int64 numBytes)
 {
-	IFileHandle* fileHandle = nullptr;
-	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if(forRead)
+	FScopeLock lock(&HandleLock);
+	if(!Handle || numBytes <= 0 || !CanWrite)
 	{
-		fileHandle = platformFile.OpenRead(*filePath, forWrite);
+		return false;
 	}
-	else if(forWrite)
+
+	if(WriteBufferSize > 0)
 	{
-		fileHandle = platformFile.OpenWrite(*filePath, false, forRead);
+		if(WriteBuffer.Num() + numBytes > WriteBufferSize && !FlushWriteBuffer())
+		{
+			return false;
+		}
+		if(numBytes < WriteBufferSize)
+		{
+			WriteBuffer.Append(bytesOut, static_cast<int32>(numBytes));
+			return true;
+		}
 	}
-	
-	URyFileHandle* handle = nullptr;
-	if(fileHandle)
+
+	return Handle->Write(bytesOut, numBytes);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyFileHandle::EnableWriteBuffering(const int32 bufferSize, const float backgroundFlushInterval)
+{
+	StopFlusher();
+
 	{
-		handle = NewObject<URyFileHandle>(outer);
-		if(handle)
+		FScopeLock lock(&HandleLock);
+		if(!Handle || !CanWrite)
 		{
-			handle->Handle = fileHandle;
-			handle->CanRead = forRead;
-			handle->CanWrite = forWrite;
-			success = true;
+			return;
+		}
+
+		// Shrinking the buffer must not drop what is already in it
+		if(bufferSize < WriteBuffer.Num() && !FlushWriteBuffer())
+		{
+			UE_LOG(LogRyRuntime, Warning, TEXT("URyFileHandle::EnableWriteBuffering: Flush failed, %d bytes kept in the write buffer"), WriteBuffer.Num());
 		}
+		WriteBufferSize = FMath::Max(bufferSize, 1);
+		WriteBuffer.Reserve(WriteBufferSize);
 	}
 
-	return handle;
+	if(backgroundFlushInterval > 0.0f && FPlatformProcess::SupportsMultithreading())
+	{
+		Flusher = new FRyFileHandleFlusher(this, backgroundFlushInterval);
+	}
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-bool URyRuntimeFileHelpers::WriteBytesToFile(const FString filePath, const bool allowOverwrite, const TArray<uint8>& bytesOut)
+void URyFileHandle::DisableWriteBuffering()
 {
-	if(FPaths::FileExists(filePath) && !allowOverwrite)
+	StopFlusher();
+
+	FScopeLock lock(&HandleLock);
+	if(!FlushWriteBuffer())
 	{
-		return false;
+		UE_LOG(LogRyRuntime, Warning, TEXT("URyFileHandle::DisableWriteBuffering: Flush failed, %d buffered bytes were lost"), WriteBuffer.Num());
 	}
+	WriteBufferSize = 0;
+	WriteBuffer.Empty();
+}
 
-	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
-	IFileHandle* fileHandle = platformFile.OpenWrite(*filePath);
-	if(fileHandle)
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyFileHandle::Flush()
+{
+	FScopeLock lock(&HandleLock);
+	if(!Handle || !FlushWriteBuffer())
 	{
-		const bool writeSuccess = fileHandle->Write(bytesOut.GetData(), bytesOut.Num());
-		delete fileHandle;
-		return writeSuccess;
+		return false;
 	}
-	
-	return false;
+
+	return Handle->Flush();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-bool URyRuntimeFileHelpers::ReadAllBytesFromFile(const FString filePath, TArray<uint8>& bytesIn)
+bool URyFileHandle::FlushWriteBuffer()
 {
-	if(!FPaths::FileExists(filePath))
+	if(WriteBuffer.Num() == 0)
+	{
+		return true;
+	}
+	if(!Handle)
 	{
 		return false;
 	}
 
-	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
-	IFileHandle* fileHandle = platformFile.OpenRead(*filePath);
-	if(fileHandle)
+	// On failure the buffer is kept and the position restored, so the next Write or Flush retries the same bytes
+	// instead of silently dropping them
+	const int64 position = Handle->Tell();
+	if(!Handle->Write(WriteBuffer.GetData(), WriteBuffer.Num()))
 	{
-		bytesIn.SetNum(fileHandle->Size());
-		const bool readSuccess = fileHandle->Read(bytesIn.GetData(), bytesIn.Num());
-		delete fileHandle;
-		return readSuccess;
+		Handle->Seek(position);
+		return false;
 	}
-	
-	return false;
+	WriteBuffer.Reset();
+	return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-bool URyRuntimeFileHelpers::ReadBytesFromFile(const FString filePath, TArray<uint8>& bytesIn, const int64 offset, const int64 numBytes)
+void URyFileHandle::StopFlusher()
 {
-	if(!FPaths::FileExists(filePath))
+	// Must not hold HandleLock here, the flusher thread may be waiting on it
+	if(Flusher)
 	{
-		return false;
+		delete Flusher;
+		Flusher = nullptr;
 	}
+}
 
-	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
-	IFileHandle* fileHandle = platformFile.OpenRead(*filePath);
-	if(fileHandle)
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int64 URyFileHandle::Size() const
+{
+	FScopeLock lock(&HandleLock);
+	if(!Handle)
 	{
-		if(!fileHandle->Seek(offset))
-		{
-			delete fileHandle;
-			return false;
-		}
-		
-		const int64 numToRead = FMath::Min(fileHandle->Size() - fileHandle->Tell(), numBytes);
-		if(numToRead <= 0)
+		return 0;
+	}
+
+	// Buffered bytes which would extend the file count towards its size
+	return FMath::Max(Handle->Size(), Handle->Tell() + WriteBuffer.Num());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyFileHandle::Close()
+{
+	StopFlusher();
+
+	FScopeLock lock(&HandleLock);
+	if(Handle)
+	{
+		if(!FlushWriteBuffer())
 		{
-			delete fileHandle;
-			return false;
+			UE_LOG(LogRyRuntime, Warning, TEXT("URyFileHandle::Close: Flush failed, %d buffered bytes were lost"), WriteBuffer.Num());
 		}
+		delete Handle;
+		Handle = nullptr;
+	}
+	WriteBufferSize = 0;
+	WriteBuffer.Empty();
+}
 
-		bytesIn.SetNum(numToRead);
-		const bool readSuccess = fileHandle->Read(bytesIn.GetData(), bytesIn.Num());
-		delete fileHandle;
-		return readSuccess;
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyMappedFile::BeginDestroy()
+{
+	UObject::BeginDestroy();
+	Unmap();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+const uint8* URyMappedFile::GetData() const
+{
+	if(MappedRegion)
+	{
+		return MappedRegion->GetMappedPtr();
 	}
-	
-	return false;
+
+	return FallbackBytes.GetData();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-bool URyRuntimeFileHelpers::SaveStringToFile(const FString& String, const FString& Filename)
+int64 URyMappedFile::Size() const
 {
-	return FFileHelper::SaveStringToFile(String, *Filename);
+	if(MappedRegion)
+	{
+		return MappedRegion->GetMappedSize();
+	}
+
+	return FallbackBytes.Num();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-bool URyRuntimeFileHelpers::SaveStringArrayToFile(const TArray<FString>& Lines, const FString& Filename)
+bool URyMappedFile::IsValid() const
 {
-	return FFileHelper::SaveStringArrayToFile(Lines, *Filename);
+	return Loaded;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-bool URyRuntimeFileHelpers::LoadFileToString(FString& Result, const FString& Filename)
+TArrayView64<const uint8> URyMappedFile::GetView(const int64 offset, const int64 numBytes) const
 {
-	return FFileHelper::LoadFileToString(Result, *Filename);
+	const int64 size = Size();
+	if(offset < 0 || offset >= size || numBytes <= 0)
+	{
+		return TArrayView64<const uint8>();
+	}
+
+	const int64 numInView = FMath::Min(size - offset, numBytes);
+	return TArrayView64<const uint8>(GetData() + offset, numInView);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-bool URyRuntimeFileHelpers::IsFilenameValidForSaving(const FString& Filename, FText& OutError)
+bool URyMappedFile::ReadSlice(TArray<uint8>& bytesOut, const int64 offset, const int64 numBytes) const
 {
-	return FFileHelper::IsFilenameValidForSaving(Filename, OutError);
+	const TArrayView64<const uint8> view = GetView(offset, FMath::Min<int64>(numBytes, MAX_int32));
+	if(view.Num() == 0)
+	{
+		return false;
+	}
+
+	bytesOut.SetNumUninitialized(static_cast<int32>(view.Num()));
+	FMemory::Memcpy(bytesOut.GetData(), view.GetData(), view.Num());
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyMappedFile::Unmap()
+{
+	// The region must be released before the handle which owns it
+	if(MappedRegion)
+	{
+		delete MappedRegion;
+		MappedRegion = nullptr;
+	}
+	if(MappedHandle)
+	{
+		delete MappedHandle;
+		MappedHandle = nullptr;
+	}
+	FallbackBytes.Empty();
+	Loaded = false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+URyFileHandle* URyRuntimeFileHelpers::OpenFileHandle(UObject* outer, const FString filePath, const bool forRead, const bool forWrite, bool& success)
+{
+	IFileHandle* fileHandle = nullptr;
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if(forRead)
+	{
+		fileHandle = platformFile.OpenRead(*filePath, forWrite);
+	}
+	else if(forWrite)
+	{
+		fileHandle = platformFile.OpenWrite(*filePath, false, forRead);
+	}
+	
+	URyFileHandle* handle = nullptr;
+	if(fileHandle)
+	{
+		handle = NewObject<URyFileHandle>(outer);
+		if(handle)
+		{
+			handle->Handle = fileHandle;
+			handle->CanRead = forRead;
+			handle->CanWrite = forWrite;
+			success = true;
+		}
+	}
+
+	return handle;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+URyMappedFile* URyRuntimeFileHelpers::OpenMappedFile(UObject* outer, const FString filePath, bool& success)
+{
+	success = false;
+
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3)
+	auto mappedResult = platformFile.OpenMappedEx(*filePath);
+	IMappedFileHandle* mappedHandle = mappedResult.HasValue() ? mappedResult.StealValue().Release() : nullptr;
+#else
+	IMappedFileHandle* mappedHandle = platformFile.OpenMapped(*filePath);
+#endif
+	IMappedFileRegion* mappedRegion = nullptr;
+	if(mappedHandle)
+	{
+		// Empty files can't be mapped, the fallback handles them
+		if(mappedHandle->GetFileSize() > 0)
+		{
+			mappedRegion = mappedHandle->MapRegion(0, mappedHandle->GetFileSize());
+		}
+		if(!mappedRegion)
+		{
+			delete mappedHandle;
+			mappedHandle = nullptr;
+		}
+	}
+
+	if(mappedRegion)
+	{
+		URyMappedFile* mappedFile = NewObject<URyMappedFile>(outer);
+		mappedFile->MappedHandle = mappedHandle;
+		mappedFile->MappedRegion = mappedRegion;
+		mappedFile->Loaded = true;
+		success = true;
+		return mappedFile;
+	}
+
+	// Mapping isn't supported on this platform or for this file, read it instead
+	TUniquePtr<IFileHandle> fileHandle(platformFile.OpenRead(*filePath));
+	if(!fileHandle)
+	{
+		return nullptr;
+	}
+
+	TArray64<uint8> fileBytes;
+	fileBytes.SetNumUninitialized(fileHandle->Size());
+	if(fileBytes.Num() > 0 && !fileHandle->Read(fileBytes.GetData(), fileBytes.Num()))
+	{
+		return nullptr;
+	}
+
+	// Only create the object once the read has succeeded. An empty file is valid, it just has no bytes.
+	URyMappedFile* mappedFile = NewObject<URyMappedFile>(outer);
+	mappedFile->FallbackBytes = MoveTemp(fileBytes);
+	mappedFile->Loaded = true;
+	success = true;
+	return mappedFile;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::WriteBytesToFile(const FString filePath, const bool allowOverwrite, const TArray<uint8>& bytesOut)
+{
+	if(FPaths::FileExists(filePath) && !allowOverwrite)
+	{
+		return false;
+	}
+
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+	IFileHandle* fileHandle = platformFile.OpenWrite(*filePath);
+	if(fileHandle)
+	{
+		const bool writeSuccess = fileHandle->Write(bytesOut.GetData(), bytesOut.Num());
+		delete fileHandle;
+		return writeSuccess;
+	}
+	
+	return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Write bytes to a temporary file next to filePath and rename it over filePath once it is complete
+ */
+static bool RyWriteFileAtomic(const FString& filePath, const uint8* bytes, const int64 numBytes, const bool allowOverwrite, const bool flushToDisk)
+{
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// The temporary file lives in the same directory so the rename never crosses a volume
+	const FString tempPath = FString::Printf(TEXT("%s.%s.rytmp"), *filePath, *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+	{
+		TUniquePtr<IFileHandle> fileHandle(platformFile.OpenWrite(*tempPath));
+		if(!fileHandle)
+		{
+			return false;
+		}
+
+		const bool writeSuccess = (numBytes == 0 || fileHandle->Write(bytes, numBytes)) && (!flushToDisk || fileHandle->Flush(true));
+		if(!writeSuccess)
+		{
+			fileHandle.Reset();
+			platformFile.DeleteFile(*tempPath);
+			return false;
+		}
+	}
+
+	// Some platforms rename over an existing file, so the overwrite check has to be done here
+	if(!allowOverwrite && platformFile.FileExists(*filePath))
+	{
+		platformFile.DeleteFile(*tempPath);
+		return false;
+	}
+
+#if PLATFORM_WINDOWS
+	// MoveFile won't replace an existing file on Windows, MoveFileEx swaps it in with a single rename
+	if(allowOverwrite)
+	{
+		const FString nativeTempPath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*tempPath);
+		const FString nativeFilePath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*filePath);
+		const DWORD moveFlags = MOVEFILE_REPLACE_EXISTING | (flushToDisk ? MOVEFILE_WRITE_THROUGH : 0);
+		if(!::MoveFileExW(*nativeTempPath, *nativeFilePath, moveFlags))
+		{
+			UE_LOG(LogRyRuntime, Warning, TEXT("WriteBytesToFileAtomic: Couldn't replace %s (error %u)"), *filePath, ::GetLastError());
+			platformFile.DeleteFile(*tempPath);
+			return false;
+		}
+		return true;
+	}
+#endif
+
+	if(!platformFile.MoveFile(*filePath, *tempPath))
+	{
+		if(!allowOverwrite || !platformFile.FileExists(*filePath))
+		{
+			platformFile.DeleteFile(*tempPath);
+			return false;
+		}
+
+		// Platforms which refuse to rename over an existing file. Move the old file aside instead of deleting it, so
+		// there is never a moment where neither the old nor the new contents exist on disk.
+		const FString backupPath = tempPath + TEXT(".rybak");
+		if(!platformFile.MoveFile(*backupPath, *filePath))
+		{
+			platformFile.DeleteFile(*tempPath);
+			return false;
+		}
+		if(!platformFile.MoveFile(*filePath, *tempPath))
+		{
+			platformFile.MoveFile(*filePath, *backupPath);
+			platformFile.DeleteFile(*tempPath);
+			return false;
+		}
+		platformFile.DeleteFile(*backupPath);
+	}
+
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::WriteBytesToFileAtomic(const FString filePath, const bool allowOverwrite, const TArray<uint8>& bytesOut, const bool flushToDisk)
+{
+	return RyWriteFileAtomic(filePath, bytesOut.GetData(), bytesOut.Num(), allowOverwrite, flushToDisk);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Background thread which writes queued files atomically.
+ * Jobs are keyed by path so a newer job for a path replaces one which hasn't been written yet.
+ */
+class FRyBackgroundFileWriter : public FRunnable
+{
+public:
+
+	static FRyBackgroundFileWriter& Get()
+	{
+		static FRyBackgroundFileWriter writer;
+		return writer;
+	}
+
+	void Queue(const FString& filePath, TArray<uint8>&& bytes, const bool flushToDisk)
+	{
+		{
+			FScopeLock pendingLock(&PendingLock);
+			FJob& job = Pending.FindOrAdd(filePath);
+			job.Bytes = MoveTemp(bytes);
+			job.FlushToDisk = flushToDisk;
+		}
+
+		if(!FPlatformProcess::SupportsMultithreading())
+		{
+			Flush();
+			return;
+		}
+
+		if(!Thread)
+		{
+			StartThread();
+		}
+		WorkEvent->Trigger();
+	}
+
+	void Flush()
+	{
+		// Holding WriteLock waits out any batch the writer thread is in the middle of
+		FScopeLock writeLock(&WriteLock);
+		WritePending();
+	}
+
+	int32 Num()
+	{
+		FScopeLock pendingLock(&PendingLock);
+		return Pending.Num();
+	}
+
+	void Shutdown()
+	{
+		if(Thread)
+		{
+			StopRequested = true;
+			WorkEvent->Trigger();
+			Thread->WaitForCompletion();
+			delete Thread;
+			Thread = nullptr;
+			StopRequested = false;
+		}
+		Flush();
+	}
+
+	virtual uint32 Run() override
+	{
+		while(!StopRequested)
+		{
+			WorkEvent->Wait();
+			FScopeLock writeLock(&WriteLock);
+			WritePending();
+		}
+		return 0;
+	}
+
+private:
+
+	struct FJob
+	{
+		TArray<uint8> Bytes;
+		bool FlushToDisk = false;
+	};
+
+	FRyBackgroundFileWriter()
+		: WorkEvent(FPlatformProcess::GetSynchEventFromPool())
+		, Thread(nullptr)
+	{
+	}
+
+	virtual ~FRyBackgroundFileWriter() override
+	{
+		// If the module never shut down the thread may still be waiting on the event
+		if(!Thread)
+		{
+			FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		}
+	}
+
+	void StartThread()
+	{
+		FScopeLock pendingLock(&PendingLock);
+		if(!Thread)
+		{
+			Thread = FRunnableThread::Create(this, TEXT("RyBackgroundFileWriter"), 0, TPri_BelowNormal);
+		}
+	}
+
+	// WriteLock must be held
+	void WritePending()
+	{
+		TMap<FString, FJob> jobs;
+		{
+			FScopeLock pendingLock(&PendingLock);
+			jobs = MoveTemp(Pending);
+			Pending.Reset();
+		}
+
+		for(const TPair<FString, FJob>& job : jobs)
+		{
+			if(!RyWriteFileAtomic(job.Key, job.Value.Bytes.GetData(), job.Value.Bytes.Num(), true, job.Value.FlushToDisk))
+			{
+				UE_LOG(LogRyRuntime, Warning, TEXT("Background file write to %s failed"), *job.Key);
+			}
+		}
+	}
+
+	FCriticalSection PendingLock;
+	FCriticalSection WriteLock;
+	TMap<FString, FJob> Pending;
+	FEvent* WorkEvent;
+	FRunnableThread* Thread;
+	FThreadSafeBool StopRequested;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::QueueBackgroundFileWrites(const TArray<FRyFileWriteJob>& jobs, const bool flushToDisk)
+{
+	for(const FRyFileWriteJob& job : jobs)
+	{
+		TArray<uint8> bytes = job.Bytes;
+		FRyBackgroundFileWriter::Get().Queue(job.FilePath, MoveTemp(bytes), flushToDisk);
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::QueueBackgroundFileWrite(const FString& filePath, TArray<uint8>&& bytes, const bool flushToDisk)
+{
+	FRyBackgroundFileWriter::Get().Queue(filePath, MoveTemp(bytes), flushToDisk);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::FlushBackgroundFileWrites()
+{
+	FRyBackgroundFileWriter::Get().Flush();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeFileHelpers::GetNumQueuedBackgroundFileWrites()
+{
+	return FRyBackgroundFileWriter::Get().Num();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::ShutdownBackgroundFileWriter()
+{
+	FRyBackgroundFileWriter::Get().Shutdown();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::ReadAllBytesFromFile(const FString filePath, TArray<uint8>& bytesIn)
+{
+	if(!FPaths::FileExists(filePath))
+	{
+		return false;
+	}
+
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+	IFileHandle* fileHandle = platformFile.OpenRead(*filePath);
+	if(fileHandle)
+	{
+		bytesIn.SetNum(fileHandle->Size());
+		const bool readSuccess = fileHandle->Read(bytesIn.GetData(), bytesIn.Num());
+		delete fileHandle;
+		return readSuccess;
+	}
+	
+	return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::ReadBytesFromFile(const FString filePath, TArray<uint8>& bytesIn, const int64 offset, const int64 numBytes)
+{
+	if(!FPaths::FileExists(filePath))
+	{
+		return false;
+	}
+
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+	IFileHandle* fileHandle = platformFile.OpenRead(*filePath);
+	if(fileHandle)
+	{
+		if(!fileHandle->Seek(offset))
+		{
+			delete fileHandle;
+			return false;
+		}
+		
+		const int64 numToRead = FMath::Min(fileHandle->Size() - fileHandle->Tell(), numBytes);
+		if(numToRead <= 0)
+		{
+			delete fileHandle;
+			return false;
+		}
+
+		bytesIn.SetNum(numToRead);
+		const bool readSuccess = fileHandle->Read(bytesIn.GetData(), bytesIn.Num());
+		delete fileHandle;
+		return readSuccess;
+	}
+	
+	return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::SaveStringToFile(const FString& String, const FString& Filename)
+{
+	return FFileHelper::SaveStringToFile(String, *Filename);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::SaveStringArrayToFile(const TArray<FString>& Lines, const FString& Filename)
+{
+	return FFileHelper::SaveStringArrayToFile(Lines, *Filename);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::LoadFileToString(FString& Result, const FString& Filename)
+{
+	return FFileHelper::LoadFileToString(Result, *Filename);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::IsFilenameValidForSaving(const FString& Filename, FText& OutError)
+{
+	return FFileHelper::IsFilenameValidForSaving(Filename, OutError);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * A single request in the async file queue. Work runs on a pool thread, Complete runs on the game thread.
+ */
+struct FRyAsyncFileRequest
+{
+	int32 Id = INDEX_NONE;
+	TFunction<ERyAsyncFileResult(const FThreadSafeBool& canceled)> Work;
+	TFunction<void(const ERyAsyncFileResult result)> Complete;
+	FThreadSafeBool Canceled;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Bounded queue of asynchronous file requests.
+ * At most MaxRunning requests do I/O at once, up to MaxQueued more wait their turn and anything past that is rejected.
+ * All bookkeeping happens on the game thread, the pool threads only run the request work.
+ */
+class FRyAsyncFileQueue
+{
+public:
+
+	static FRyAsyncFileQueue& Get()
+	{
+		static FRyAsyncFileQueue queue;
+		return queue;
+	}
+
+	int32 Enqueue(TFunction<ERyAsyncFileResult(const FThreadSafeBool& canceled)> work, TFunction<void(const ERyAsyncFileResult result)> complete)
+	{
+		check(IsInGameThread());
+		if(Running.Num() >= MaxRunning && Pending.Num() >= MaxQueued)
+		{
+			complete(ERyAsyncFileResult::QueueFull);
+			return INDEX_NONE;
+		}
+
+		TSharedRef<FRyAsyncFileRequest, ESPMode::ThreadSafe> request = MakeShared<FRyAsyncFileRequest, ESPMode::ThreadSafe>();
+		request->Id = NextId;
+		NextId = NextId == MAX_int32 ? 0 : NextId + 1;
+		request->Work = MoveTemp(work);
+		request->Complete = MoveTemp(complete);
+		Pending.Add(request);
+		StartPending();
+		return request->Id;
+	}
+
+	bool Cancel(const int32 id)
+	{
+		check(IsInGameThread());
+		for(int32 pendingIndex = 0; pendingIndex < Pending.Num(); ++pendingIndex)
+		{
+			if(Pending[pendingIndex]->Id == id)
+			{
+				TSharedRef<FRyAsyncFileRequest, ESPMode::ThreadSafe> request = Pending[pendingIndex];
+				Pending.RemoveAt(pendingIndex);
+				request->Complete(ERyAsyncFileResult::Canceled);
+				return true;
+			}
+		}
+
+		if(TSharedRef<FRyAsyncFileRequest, ESPMode::ThreadSafe>* request = Running.Find(id))
+		{
+			(*request)->Canceled = true;
+			return true;
+		}
+
+		return false;
+	}
+
+	int32 Num() const
+	{
+		return Running.Num() + Pending.Num();
+	}
+
+	void SetLimits(const int32 maxRunning, const int32 maxQueued)
+	{
+		check(IsInGameThread());
+		MaxRunning = FMath::Max(1, maxRunning);
+		MaxQueued = FMath::Max(0, maxQueued);
+		StartPending();
+	}
+
+private:
+
+	void StartPending()
+	{
+		while(Running.Num() < MaxRunning && Pending.Num() > 0)
+		{
+			TSharedRef<FRyAsyncFileRequest, ESPMode::ThreadSafe> request = Pending[0];
+			Pending.RemoveAt(0);
+			Running.Add(request->Id, request);
+
+			Async(EAsyncExecution::ThreadPool, [this, request]()
+			{
+				const ERyAsyncFileResult result = request->Canceled ? ERyAsyncFileResult::Canceled : request->Work(request->Canceled);
+				AsyncTask(ENamedThreads::GameThread, [this, request, result]()
+				{
+					Running.Remove(request->Id);
+					request->Complete(request->Canceled ? ERyAsyncFileResult::Canceled : result);
+					StartPending();
+				});
+			});
+		}
+	}
+
+	TArray<TSharedRef<FRyAsyncFileRequest, ESPMode::ThreadSafe>> Pending;
+	TMap<int32, TSharedRef<FRyAsyncFileRequest, ESPMode::ThreadSafe>> Running;
+	int32 NextId = 0;
+	int32 MaxRunning = 4;
+	int32 MaxQueued = 128;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Read all bytes of a file in chunks so the read can be canceled part way through
+ */
+static ERyAsyncFileResult RyReadAllBytesCancelable(const FString& filePath, TArray<uint8>& bytesIn, const FThreadSafeBool& canceled)
+{
+	static constexpr int64 ChunkSize = 1024 * 1024;
+
+	TUniquePtr<IFileHandle> fileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*filePath));
+	if(!fileHandle)
+	{
+		return ERyAsyncFileResult::Failed;
+	}
+
+	const int64 fileSize = fileHandle->Size();
+	if(fileSize > MAX_int32)
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("File %s is too large to read into a byte array"), *filePath);
+		return ERyAsyncFileResult::Failed;
+	}
+
+	bytesIn.SetNumUninitialized(static_cast<int32>(fileSize));
+	for(int64 offset = 0; offset < fileSize; offset += ChunkSize)
+	{
+		if(canceled)
+		{
+			bytesIn.Empty();
+			return ERyAsyncFileResult::Canceled;
+		}
+		if(!fileHandle->Read(bytesIn.GetData() + offset, FMath::Min(ChunkSize, fileSize - offset)))
+		{
+			bytesIn.Empty();
+			return ERyAsyncFileResult::Failed;
+		}
+	}
+
+	return ERyAsyncFileResult::Success;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeFileHelpers::ReadAllBytesFromFileAsync(const FString& filePath, RyNativeAsyncBytesReadSig onComplete)
+{
+	TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> bytes = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+	return FRyAsyncFileQueue::Get().Enqueue(
+		[filePath, bytes](const FThreadSafeBool& canceled)
+		{
+			return RyReadAllBytesCancelable(filePath, *bytes, canceled);
+		},
+		[bytes, onComplete](const ERyAsyncFileResult result)
+		{
+			if(onComplete)
+			{
+				onComplete(result, *bytes);
+			}
+		});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeFileHelpers::WriteBytesToFileAsync(const FString& filePath, const bool allowOverwrite, TArray<uint8> bytesOut, RyNativeAsyncWriteSig onComplete)
+{
+	TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> bytes = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(bytesOut));
+	return FRyAsyncFileQueue::Get().Enqueue(
+		[filePath, allowOverwrite, bytes](const FThreadSafeBool& canceled)
+		{
+			return WriteBytesToFile(filePath, allowOverwrite, *bytes) ? ERyAsyncFileResult::Success : ERyAsyncFileResult::Failed;
+		},
+		[onComplete](const ERyAsyncFileResult result)
+		{
+			if(onComplete)
+			{
+				onComplete(result);
+			}
+		});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeFileHelpers::SaveStringToFileAsync(const FString& String, const FString& Filename, RyNativeAsyncWriteSig onComplete)
+{
+	return FRyAsyncFileQueue::Get().Enqueue(
+		[String, Filename](const FThreadSafeBool& canceled)
+		{
+			return FFileHelper::SaveStringToFile(String, *Filename) ? ERyAsyncFileResult::Success : ERyAsyncFileResult::Failed;
+		},
+		[onComplete](const ERyAsyncFileResult result)
+		{
+			if(onComplete)
+			{
+				onComplete(result);
+			}
+		});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeFileHelpers::LoadFileToStringAsync(const FString& Filename, RyNativeAsyncStringReadSig onComplete)
+{
+	TSharedRef<FString, ESPMode::ThreadSafe> loaded = MakeShared<FString, ESPMode::ThreadSafe>();
+	return FRyAsyncFileQueue::Get().Enqueue(
+		[Filename, loaded](const FThreadSafeBool& canceled)
+		{
+			return FFileHelper::LoadFileToString(*loaded, *Filename) ? ERyAsyncFileResult::Success : ERyAsyncFileResult::Failed;
+		},
+		[loaded, onComplete](const ERyAsyncFileResult result)
+		{
+			if(onComplete)
+			{
+				onComplete(result, *loaded);
+			}
+		});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::CancelAsyncFileRequest(const int32 requestId)
+{
+	return FRyAsyncFileQueue::Get().Cancel(requestId);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimeFileHelpers::GetNumAsyncFileRequests()
+{
+	return FRyAsyncFileQueue::Get().Num();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::SetAsyncFileQueueLimits(const int32 maxRunning, const int32 maxQueued)
+{
+	FRyAsyncFileQueue::Get().SetLimits(maxRunning, maxQueued);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * State shared between an async file latent action and its request completion callback.
+ * Either can end first, so neither holds a pointer to the other.
+ */
+struct FRyAsyncFileLatentState
+{
+	bool Done = false;
+	ERyAsyncFileResult Result = ERyAsyncFileResult::Failed;
+	int32 RequestId = INDEX_NONE;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Latent action which waits on an async file request. The request is canceled if the action is aborted.
+ * Output parameters live in the calling Blueprint frame, so they are only written from UpdateOperation.
+ */
+class FRyAsyncFileLatentAction : public FPendingLatentAction
+{
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+	ERyAsyncFileResult* Result;
+
+	TSharedRef<FRyAsyncFileLatentState> State;
+	TFunction<void()> ApplyOutputs;
+
+	FRyAsyncFileLatentAction(const FLatentActionInfo& LatentInfo, ERyAsyncFileResult& ResultOut)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, Result(&ResultOut)
+		, State(MakeShared<FRyAsyncFileLatentState>())
+	{
+	}
+
+	virtual ~FRyAsyncFileLatentAction() override
+	{
+		if(!State->Done && State->RequestId != INDEX_NONE)
+		{
+			FRyAsyncFileQueue::Get().Cancel(State->RequestId);
+		}
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if(State->Done)
+		{
+			*Result = State->Result;
+			if(ApplyOutputs && State->Result == ERyAsyncFileResult::Success)
+			{
+				ApplyOutputs();
+			}
+		}
+		Response.FinishAndTriggerIf(State->Done, ExecutionFunction, OutputLink, CallbackTarget);
+	}
+
+	/** Completion callback to pass to the async request */
+	TFunction<void(const ERyAsyncFileResult result)> MakeCompletion() const
+	{
+		TSharedRef<FRyAsyncFileLatentState> state = State;
+		return [state](const ERyAsyncFileResult result)
+		{
+			state->Result = result;
+			state->Done = true;
+		};
+	}
+
+#if WITH_EDITOR
+	virtual FString GetDescription() const override
+	{
+		return FString::Printf(TEXT("Async File Request: %d"), State->RequestId);
+	}
+#endif
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+static FRyAsyncFileLatentAction* RyAddAsyncFileLatentAction(UObject* WorldContextObject, const FLatentActionInfo& LatentInfo, ERyAsyncFileResult& result)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FRyAsyncFileLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			result = ERyAsyncFileResult::Failed;
+			FRyAsyncFileLatentAction* action = new FRyAsyncFileLatentAction(LatentInfo, result);
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, action);
+			return action;
+		}
+	}
+
+	return nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::ReadAllBytesFromFileLatent(UObject* WorldContextObject, const FString filePath, TArray<uint8>& bytesIn, ERyAsyncFileResult& result, FLatentActionInfo LatentInfo)
+{
+	if(FRyAsyncFileLatentAction* action = RyAddAsyncFileLatentAction(WorldContextObject, LatentInfo, result))
+	{
+		TSharedRef<TArray<uint8>> bytes = MakeShared<TArray<uint8>>();
+		TArray<uint8>* bytesOut = &bytesIn;
+		action->ApplyOutputs = [bytes, bytesOut]()
+		{
+			*bytesOut = MoveTemp(*bytes);
+		};
+
+		TFunction<void(const ERyAsyncFileResult)> completion = action->MakeCompletion();
+		action->State->RequestId = ReadAllBytesFromFileAsync(filePath, [bytes, completion](const ERyAsyncFileResult asyncResult, TArray<uint8>& bytesRead)
+		{
+			*bytes = MoveTemp(bytesRead);
+			completion(asyncResult);
+		});
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::WriteBytesToFileLatent(UObject* WorldContextObject, const FString filePath, const bool allowOverwrite, const TArray<uint8>& bytesOut, ERyAsyncFileResult& result, FLatentActionInfo LatentInfo)
+{
+	if(FRyAsyncFileLatentAction* action = RyAddAsyncFileLatentAction(WorldContextObject, LatentInfo, result))
+	{
+		action->State->RequestId = WriteBytesToFileAsync(filePath, allowOverwrite, bytesOut, action->MakeCompletion());
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::SaveStringToFileLatent(UObject* WorldContextObject, const FString& String, const FString& Filename, ERyAsyncFileResult& result, FLatentActionInfo LatentInfo)
+{
+	if(FRyAsyncFileLatentAction* action = RyAddAsyncFileLatentAction(WorldContextObject, LatentInfo, result))
+	{
+		action->State->RequestId = SaveStringToFileAsync(String, Filename, action->MakeCompletion());
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::LoadFileToStringLatent(UObject* WorldContextObject, const FString& Filename, FString& fileContents, ERyAsyncFileResult& result, FLatentActionInfo LatentInfo)
+{
+	if(FRyAsyncFileLatentAction* action = RyAddAsyncFileLatentAction(WorldContextObject, LatentInfo, result))
+	{
+		TSharedRef<FString> loaded = MakeShared<FString>();
+		FString* stringOut = &fileContents;
+		action->ApplyOutputs = [loaded, stringOut]()
+		{
+			*stringOut = MoveTemp(*loaded);
+		};
+
+		TFunction<void(const ERyAsyncFileResult)> completion = action->MakeCompletion();
+		action->State->RequestId = LoadFileToStringAsync(Filename, [loaded, completion](const ERyAsyncFileResult asyncResult, FString& stringRead)
+		{
+			*loaded = MoveTemp(stringRead);
+			completion(asyncResult);
+		});
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Reads a file chunk by chunk through IAsyncReadFileHandle using two buffers.
+ * When a chunk is handed out the read of the chunk after it is issued into the other buffer, so reading the next
+ * chunk overlaps processing the current one.
+ */
+class FRyFileChunkStreamer
+{
+public:
+
+	FRyFileChunkStreamer(const FString& filePath, const int32 chunkSize)
+		: ChunkSize(FMath::Max(chunkSize, 1))
+		, StartTime(FPlatformTime::Seconds())
+	{
+		IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+		FileSize = platformFile.FileSize(*filePath);
+		if(FileSize >= 0)
+		{
+			AsyncHandle = platformFile.OpenAsyncRead(*filePath);
+		}
+		if(AsyncHandle && FileSize > 0)
+		{
+			IssueRead(0, 0);
+		}
+	}
+
+	~FRyFileChunkStreamer()
+	{
+		// Outstanding requests must complete before their buffers or the handle go away
+		for(IAsyncReadRequest*& request : Requests)
+		{
+			if(request)
+			{
+				request->Cancel();
+				request->WaitCompletion();
+				delete request;
+				request = nullptr;
+			}
+		}
+		delete AsyncHandle;
+	}
+
+	bool IsValid() const { return AsyncHandle != nullptr && !Failed; }
+	bool IsFinished() const { return Requests[DeliverIndex] == nullptr; }
+
+	/**
+	 * Get the next chunk if it has been read. The chunk is valid until the next call.
+	 * @param wait If true, blocks until the chunk has been read
+	 */
+	bool GetNextChunk(const bool wait, TArray<uint8>*& chunkOut, int64& offsetOut)
+	{
+		IAsyncReadRequest* request = Requests[DeliverIndex];
+		if(!request)
+		{
+			return false;
+		}
+		if(wait)
+		{
+			request->WaitCompletion();
+		}
+		else if(!request->PollCompletion())
+		{
+			return false;
+		}
+
+		// The buffer is ours, a null result only means the read failed
+		const bool readSuccess = request->GetReadResults() != nullptr;
+		delete request;
+		Requests[DeliverIndex] = nullptr;
+		if(!readSuccess)
+		{
+			Failed = true;
+			return false;
+		}
+
+		chunkOut = &Buffers[DeliverIndex];
+		offsetOut = Offsets[DeliverIndex];
+		Stats.BytesRead += chunkOut->Num();
+		++Stats.ChunksRead;
+
+		const int64 nextOffset = offsetOut + chunkOut->Num();
+		DeliverIndex ^= 1;
+		if(nextOffset < FileSize)
+		{
+			IssueRead(DeliverIndex, nextOffset);
+		}
+		return true;
+	}
+
+	const FRyFileStreamStats& GetStats()
+	{
+		Stats.Seconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+		Stats.BytesPerSecond = Stats.Seconds > 0.0f ? static_cast<float>(Stats.BytesRead / Stats.Seconds) : 0.0f;
+		return Stats;
+	}
+
+private:
+
+	void IssueRead(const int32 bufferIndex, const int64 offset)
+	{
+		const int64 numBytes = FMath::Min<int64>(ChunkSize, FileSize - offset);
+		Buffers[bufferIndex].SetNumUninitialized(static_cast<int32>(numBytes));
+		Offsets[bufferIndex] = offset;
+		Requests[bufferIndex] = AsyncHandle->ReadRequest(offset, numBytes, AIOP_Normal, nullptr, Buffers[bufferIndex].GetData());
+	}
+
+	const int32 ChunkSize;
+	const double StartTime;
+	int64 FileSize = -1;
+	IAsyncReadFileHandle* AsyncHandle = nullptr;
+	IAsyncReadRequest* Requests[2] = { nullptr, nullptr };
+	TArray<uint8> Buffers[2];
+	int64 Offsets[2] = { 0, 0 };
+	int32 DeliverIndex = 0;
+	bool Failed = false;
+	FRyFileStreamStats Stats;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::StreamFileChunks(const FString& filePath, const int32 chunkSize, RyNativeFileChunkSig onChunk, FRyFileStreamStats& stats)
+{
+	FRyFileChunkStreamer streamer(filePath, chunkSize);
+	TArray<uint8>* chunk = nullptr;
+	int64 offset = 0;
+	while(streamer.GetNextChunk(true, chunk, offset))
+	{
+		if(onChunk && !onChunk(TArrayView<const uint8>(*chunk), offset))
+		{
+			break;
+		}
+	}
+
+	stats = streamer.GetStats();
+	return streamer.IsValid();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+class FRyFileChunkStreamLatentAction : public FPendingLatentAction
+{
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+	FRyFileChunkStreamer Streamer;
+	FRyFileChunkVisitor OnChunk;
+	const int32 MaxChunksPerTick;
+	FRyFileStreamStats* StatsOut;
+	bool* SuccessOut;
+
+	FRyFileChunkStreamLatentAction(const FLatentActionInfo& LatentInfo, const FString& filePath, const int32 chunkSize, const int32 maxChunksPerTick,
+	                               FRyFileChunkVisitor onChunk, FRyFileStreamStats& stats, bool& success)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, Streamer(filePath, chunkSize)
+		, OnChunk(onChunk)
+		, MaxChunksPerTick(FMath::Max(maxChunksPerTick, 1))
+		, StatsOut(&stats)
+		, SuccessOut(&success)
+	{
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		bool keepGoing = true;
+		TArray<uint8>* chunk = nullptr;
+		int64 offset = 0;
+		for(int32 chunkNum = 0; chunkNum < MaxChunksPerTick && keepGoing; ++chunkNum)
+		{
+			if(!Streamer.GetNextChunk(false, chunk, offset))
+			{
+				break;
+			}
+			if(OnChunk.IsBound())
+			{
+				keepGoing = OnChunk.Execute(*chunk, offset);
+			}
+		}
+
+		const bool done = !keepGoing || !Streamer.IsValid() || Streamer.IsFinished();
+		if(done)
+		{
+			*StatsOut = Streamer.GetStats();
+			*SuccessOut = Streamer.IsValid();
+		}
+		Response.FinishAndTriggerIf(done, ExecutionFunction, OutputLink, CallbackTarget);
+	}
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::StreamFileChunksLatent(UObject* WorldContextObject, const FString filePath, FRyFileChunkVisitor OnChunk, FRyFileStreamStats& stats, bool& success,
+                                                   FLatentActionInfo LatentInfo, const int32 chunkSize, const int32 maxChunksPerTick)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FRyFileChunkStreamLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			success = false;
+			FRyFileChunkStreamLatentAction* action = new FRyFileChunkStreamLatentAction(LatentInfo, filePath, chunkSize, maxChunksPerTick, OnChunk, stats, success);
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, action);
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+class FRyFileLineLatentAction : public FPendingLatentAction
+{
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+	FRyFileLineReader Reader;
+	FRyFileLineVisitor OnLine;
+	const int32 BatchSize;
+	int64* NumLinesOut;
+	bool* SuccessOut;
+
+	// Reused so each line only copies into existing storage
+	FString LineString;
+
+	FRyFileLineLatentAction(const FLatentActionInfo& LatentInfo, const FString& filePath, const int32 batchSize, FRyFileLineVisitor onLine, int64& numLines, bool& success)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, Reader(filePath)
+		, OnLine(onLine)
+		, BatchSize(FMath::Max(batchSize, 1))
+		, NumLinesOut(&numLines)
+		, SuccessOut(&success)
+	{
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		bool keepGoing = Reader.IsValid();
+		bool endOfFile = false;
+		FStringView line;
+		for(int32 lineNum = 0; lineNum < BatchSize && keepGoing; ++lineNum)
+		{
+			if(!Reader.ReadLine(line))
+			{
+				endOfFile = true;
+				break;
+			}
+			if(OnLine.IsBound())
+			{
+				LineString.Reset(line.Len());
+				LineString.Append(line.GetData(), line.Len());
+				keepGoing = OnLine.Execute(LineString, Reader.GetLineNumber());
+			}
+		}
+
+		const bool done = endOfFile || !keepGoing || !Reader.IsValid();
+		if(done)
+		{
+			*NumLinesOut = Reader.GetLineNumber();
+			*SuccessOut = Reader.IsValid();
+		}
+		Response.FinishAndTriggerIf(done, ExecutionFunction, OutputLink, CallbackTarget);
+	}
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::ForEachLineInFileLatent(UObject* WorldContextObject, const FString filePath, FRyFileLineVisitor OnLine, int64& numLines, bool& success,
+                                                    FLatentActionInfo LatentInfo, const int32 batchSize)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FRyFileLineLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			numLines = 0;
+			success = false;
+			FRyFileLineLatentAction* action = new FRyFileLineLatentAction(LatentInfo, filePath, batchSize, OnLine, numLines, success);
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, action);
+		}
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Compressed file layout:
+ * uint32 Magic, uint32 Version, uint8 Format, uint32 BlockSize, uint64 UncompressedSize, uint32 NumBlocks,
+ * uint32 CompressedBlockSizes[NumBlocks], followed by the blocks back to back.
+ * A block whose compressed size equals its uncompressed size is stored raw.
+ */
+namespace RyCompressedFile
+{
+	constexpr uint32 Magic = 0x42435952; // RYCB
+	constexpr uint32 Version = 1;
+	constexpr int64 FixedHeaderSize = 25;
+
+	static FName GetFormatName(const ERyCompressionFormat format)
+	{
+		switch(format)
+		{
+			case ERyCompressionFormat::Gzip:
+				return NAME_Gzip;
+			case ERyCompressionFormat::LZ4:
+				return NAME_LZ4;
+			case ERyCompressionFormat::Oodle:
+				return FName(TEXT("Oodle"));
+			default:
+				return NAME_Zlib;
+		}
+	}
+
+	static ECompressionFlags GetFlags(const ERyCompressionLevel level)
+	{
+		switch(level)
+		{
+			case ERyCompressionLevel::Fastest:
+				return COMPRESS_BiasSpeed;
+			case ERyCompressionLevel::Smallest:
+#if ENGINE_MAJOR_VERSION >= 5
+				return COMPRESS_BiasSize;
+#else
+				return COMPRESS_BiasMemory;
+#endif
+			default:
+				return COMPRESS_NoFlags;
+		}
+	}
+
+	struct FHeader
+	{
+		ERyCompressionFormat Format = ERyCompressionFormat::Zlib;
+		int64 BlockSize = 0;
+		int64 UncompressedSize = 0;
+		TArray<uint32> BlockSizes;
+		// Offset of each block from the start of the file, with one extra entry for the end of the last block
+		TArray<int64> BlockOffsets;
+
+		int64 GetUncompressedBlockSize(const int32 blockIndex) const
+		{
+			return FMath::Min(BlockSize, UncompressedSize - blockIndex * BlockSize);
+		}
+
+		bool Read(IFileHandle& fileHandle)
+		{
+			TArray<uint8> fixedBytes;
+			fixedBytes.SetNumUninitialized(FixedHeaderSize);
+			if(!fileHandle.Read(fixedBytes.GetData(), FixedHeaderSize))
+			{
+				return false;
+			}
+
+			FMemoryReader fixedReader(fixedBytes);
+			uint32 magic = 0, version = 0, blockSize = 0, numBlocks = 0;
+			uint8 format = 0;
+			uint64 uncompressedSize = 0;
+			fixedReader << magic << version << format << blockSize << uncompressedSize << numBlocks;
+			if(magic != Magic || version != Version || blockSize == 0 || uncompressedSize > MAX_int64 ||
+			   numBlocks != FMath::DivideAndRoundUp<uint64>(uncompressedSize, blockSize))
+			{
+				return false;
+			}
+
+			// The fields come straight from the file, so a corrupt header must be rejected before anything is sized by them
+			if(format > static_cast<uint8>(ERyCompressionFormat::Oodle) || numBlocks >= static_cast<uint32>(MAX_int32) ||
+			   FixedHeaderSize + static_cast<int64>(numBlocks) * static_cast<int64>(sizeof(uint32)) > fileHandle.Size())
+			{
+				return false;
+			}
+
+			Format = static_cast<ERyCompressionFormat>(format);
+			BlockSize = blockSize;
+			UncompressedSize = static_cast<int64>(uncompressedSize);
+			BlockSizes.SetNumUninitialized(numBlocks);
+			if(numBlocks > 0 && !fileHandle.Read(reinterpret_cast<uint8*>(BlockSizes.GetData()), numBlocks * sizeof(uint32)))
+			{
+				return false;
+			}
+
+			BlockOffsets.SetNumUninitialized(numBlocks + 1);
+			BlockOffsets[0] = FixedHeaderSize + numBlocks * sizeof(uint32);
+			for(uint32 blockIndex = 0; blockIndex < numBlocks; ++blockIndex)
+			{
+				if(BlockSizes[blockIndex] > GetUncompressedBlockSize(blockIndex))
+				{
+					return false;
+				}
+				BlockOffsets[blockIndex + 1] = BlockOffsets[blockIndex] + BlockSizes[blockIndex];
+			}
+			return BlockOffsets.Last() <= fileHandle.Size();
+		}
+	};
+
+	/**
+	 * Read blocks [firstBlock, lastBlock] with one read and decompress them in parallel into bytesOut.
+	 * bytesOut must be sized to hold the uncompressed blocks.
+	 */
+	static bool ReadBlocks(IFileHandle& fileHandle, const FHeader& header, const int32 firstBlock, const int32 lastBlock, uint8* bytesOut)
+	{
+		const int64 compressedStart = header.BlockOffsets[firstBlock];
+		TArray64<uint8> compressedBytes;
+		compressedBytes.SetNumUninitialized(header.BlockOffsets[lastBlock + 1] - compressedStart);
+		if(!fileHandle.Seek(compressedStart) || !fileHandle.Read(compressedBytes.GetData(), compressedBytes.Num()))
+		{
+			return false;
+		}
+
+		const FName formatName = GetFormatName(header.Format);
+		FThreadSafeBool failed;
+		ParallelFor(lastBlock - firstBlock + 1, [&](const int32 blockNum)
+		{
+			const int32 blockIndex = firstBlock + blockNum;
+			const int64 uncompressedBlockSize = header.GetUncompressedBlockSize(blockIndex);
+			const uint8* compressedBlock = compressedBytes.GetData() + (header.BlockOffsets[blockIndex] - compressedStart);
+			uint8* uncompressedBlock = bytesOut + blockNum * header.BlockSize;
+			if(header.BlockSizes[blockIndex] == uncompressedBlockSize)
+			{
+				FMemory::Memcpy(uncompressedBlock, compressedBlock, uncompressedBlockSize);
+			}
+			else if(!FCompression::UncompressMemory(formatName, uncompressedBlock, static_cast<int32>(uncompressedBlockSize),
+			                                        compressedBlock, static_cast<int32>(header.BlockSizes[blockIndex])))
+			{
+				failed = true;
+			}
+		}, firstBlock == lastBlock);
+
+		return !failed;
+	}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::WriteCompressedBytesToFile(const FString filePath, const bool allowOverwrite, const TArray<uint8>& bytesOut,
+                                                       const ERyCompressionFormat format, const ERyCompressionLevel level, const int32 blockSize)
+{
+	const FName formatName = RyCompressedFile::GetFormatName(format);
+	const ECompressionFlags flags = RyCompressedFile::GetFlags(level);
+	if(!FCompression::IsFormatValid(formatName))
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("WriteCompressedBytesToFile: Compression format %s is not available"), *formatName.ToString());
+		return false;
+	}
+
+	const int32 clampedBlockSize = FMath::Max(blockSize, 4096);
+	const int32 numBlocks = FMath::DivideAndRoundUp(bytesOut.Num(), clampedBlockSize);
+
+	// Compress every block on its own so they can be compressed and later decompressed in parallel
+	TArray<TArray<uint8>> compressedBlocks;
+	compressedBlocks.SetNum(numBlocks);
+	ParallelFor(numBlocks, [&](const int32 blockIndex)
+	{
+		const int32 blockStart = blockIndex * clampedBlockSize;
+		const int32 uncompressedBlockSize = FMath::Min(clampedBlockSize, bytesOut.Num() - blockStart);
+		TArray<uint8>& compressedBlock = compressedBlocks[blockIndex];
+		int32 compressedSize = FCompression::CompressMemoryBound(formatName, uncompressedBlockSize, flags);
+		compressedBlock.SetNumUninitialized(compressedSize);
+		if(FCompression::CompressMemory(formatName, compressedBlock.GetData(), compressedSize, bytesOut.GetData() + blockStart, uncompressedBlockSize, flags) &&
+		   compressedSize < uncompressedBlockSize)
+		{
+			compressedBlock.SetNum(compressedSize);
+		}
+		else
+		{
+			// Incompressible blocks are stored raw, marked by matching sizes
+			compressedBlock.SetNumUninitialized(uncompressedBlockSize);
+			FMemory::Memcpy(compressedBlock.GetData(), bytesOut.GetData() + blockStart, uncompressedBlockSize);
+		}
+	}, numBlocks <= 1);
+
+	TArray<uint8> fileBytes;
+	FMemoryWriter writer(fileBytes);
+	uint32 magic = RyCompressedFile::Magic;
+	uint32 version = RyCompressedFile::Version;
+	uint8 formatByte = static_cast<uint8>(format);
+	uint32 blockSizeOut = clampedBlockSize;
+	uint64 uncompressedSize = bytesOut.Num();
+	uint32 numBlocksOut = numBlocks;
+	writer << magic << version << formatByte << blockSizeOut << uncompressedSize << numBlocksOut;
+	for(const TArray<uint8>& compressedBlock : compressedBlocks)
+	{
+		uint32 compressedBlockSize = compressedBlock.Num();
+		writer << compressedBlockSize;
+	}
+	for(TArray<uint8>& compressedBlock : compressedBlocks)
+	{
+		writer.Serialize(compressedBlock.GetData(), compressedBlock.Num());
+	}
+
+	return RyWriteFileAtomic(filePath, fileBytes.GetData(), fileBytes.Num(), allowOverwrite, false);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::ReadCompressedBytesFromFile(const FString filePath, TArray<uint8>& bytesIn)
+{
+	return ReadCompressedBytesRange(filePath, bytesIn, 0, MAX_int64);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::ReadCompressedBytesRange(const FString filePath, TArray<uint8>& bytesIn, const int64 offset, const int64 numBytes)
+{
+	TUniquePtr<IFileHandle> fileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*filePath));
+	RyCompressedFile::FHeader header;
+	if(!fileHandle || !header.Read(*fileHandle))
+	{
+		return false;
+	}
+
+	if(offset < 0 || numBytes <= 0 || offset > header.UncompressedSize)
+	{
+		return false;
+	}
+
+	const int64 numToRead = FMath::Min(header.UncompressedSize - offset, numBytes);
+	if(numToRead > MAX_int32)
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("ReadCompressedBytesRange: %s is too large to read into a byte array"), *filePath);
+		return false;
+	}
+	if(numToRead == 0)
+	{
+		bytesIn.Reset();
+		return true;
+	}
+
+	const int32 firstBlock = static_cast<int32>(offset / header.BlockSize);
+	const int32 lastBlock = static_cast<int32>((offset + numToRead - 1) / header.BlockSize);
+	const int64 blocksStart = firstBlock * header.BlockSize;
+	const int64 blocksEnd = FMath::Min(header.UncompressedSize, (lastBlock + 1) * header.BlockSize);
+
+	// Block aligned ranges, like reading the whole file, decompress straight into the output
+	if(blocksStart == offset && blocksEnd == offset + numToRead)
+	{
+		bytesIn.SetNumUninitialized(static_cast<int32>(numToRead));
+		return RyCompressedFile::ReadBlocks(*fileHandle, header, firstBlock, lastBlock, bytesIn.GetData());
+	}
+
+	TArray64<uint8> blockBytes;
+	blockBytes.SetNumUninitialized(blocksEnd - blocksStart);
+	if(!RyCompressedFile::ReadBlocks(*fileHandle, header, firstBlock, lastBlock, blockBytes.GetData()))
+	{
+		return false;
+	}
+
+	bytesIn.SetNumUninitialized(static_cast<int32>(numToRead));
+	FMemory::Memcpy(bytesIn.GetData(), blockBytes.GetData() + (offset - blocksStart), numToRead);
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::GetCompressedFileUncompressedSize(const FString filePath, int64& uncompressedSize)
+{
+	TUniquePtr<IFileHandle> fileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*filePath));
+	RyCompressedFile::FHeader header;
+	if(!fileHandle || !header.Read(*fileHandle))
+	{
+		return false;
+	}
+
+	uncompressedSize = header.UncompressedSize;
+	return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Incrementally hashes a stream of bytes with one of the ERyFileHashAlgorithm algorithms
+ */
+class FRyStreamingHash
+{
+public:
+
+	explicit FRyStreamingHash(const ERyFileHashAlgorithm algorithm)
+		: Algorithm(algorithm)
+	{
+	}
+
+	bool IsSupported() const
+	{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
+		return true;
+#else
+		return Algorithm == ERyFileHashAlgorithm::SHA1;
+#endif
+	}
+
+	void Update(const uint8* bytes, const int64 numBytes)
+	{
+		switch(Algorithm)
+		{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
+			case ERyFileHashAlgorithm::XxHash64:
+				XxHash64.Update(bytes, numBytes);
+				break;
+			case ERyFileHashAlgorithm::XxHash128:
+				XxHash128.Update(bytes, numBytes);
+				break;
+#endif
+			case ERyFileHashAlgorithm::SHA1:
+				Sha1.Update(bytes, numBytes);
+				break;
+			default:
+				break;
+		}
+	}
+
+	FString Finalize()
+	{
+		switch(Algorithm)
+		{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
+			case ERyFileHashAlgorithm::XxHash64:
+				return FString::Printf(TEXT("%016llx"), XxHash64.Finalize().Hash);
+			case ERyFileHashAlgorithm::XxHash128:
+			{
+				const FXxHash128 hash = XxHash128.Finalize();
+				return FString::Printf(TEXT("%016llx%016llx"), hash.HashHigh, hash.HashLow);
+			}
+#endif
+			case ERyFileHashAlgorithm::SHA1:
+			{
+				uint8 hash[FSHA1::DigestSize];
+				Sha1.Final();
+				Sha1.GetHash(hash);
+				return BytesToHex(hash, FSHA1::DigestSize).ToLower();
+			}
+			default:
+				return FString();
+		}
+	}
+
+private:
+	const ERyFileHashAlgorithm Algorithm;
+	FSHA1 Sha1;
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
+	FXxHash64Builder XxHash64;
+	FXxHash128Builder XxHash128;
+#endif
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::HashFile(const FString& filePath, const ERyFileHashAlgorithm algorithm, FString& hash, FRyFileStreamStats& stats)
+{
+	FRyStreamingHash hasher(algorithm);
+	if(!hasher.IsSupported())
+	{
+		UE_LOG(LogRyRuntime, Warning, TEXT("HashFile: The hash algorithm isn't supported on this engine version"));
+		return false;
+	}
+
+	const bool streamSuccess = StreamFileChunks(filePath, 1024 * 1024, [&hasher](TArrayView<const uint8> chunk, const int64 offset)
+	{
+		hasher.Update(chunk.GetData(), chunk.Num());
+		return true;
+	}, stats);
+
+	hash = streamSuccess ? hasher.Finalize() : FString();
+	return streamSuccess;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimeFileHelpers::HashFiles(const TArray<FString>& filePaths, const ERyFileHashAlgorithm algorithm, TArray<FString>& hashes, FRyFileStreamStats& stats)
+{
+	const double startTime = FPlatformTime::Seconds();
+	TArray<FRyFileStreamStats> fileStats;
+	fileStats.SetNum(filePaths.Num());
+	hashes.Reset(filePaths.Num());
+	hashes.SetNum(filePaths.Num());
+
+	FThreadSafeBool failed;
+	ParallelFor(filePaths.Num(), [&](const int32 fileIndex)
+	{
+		if(!HashFile(filePaths[fileIndex], algorithm, hashes[fileIndex], fileStats[fileIndex]))
+		{
+			failed = true;
+		}
+	}, filePaths.Num() <= 1);
+
+	stats = FRyFileStreamStats();
+	for(const FRyFileStreamStats& fileStat : fileStats)
+	{
+		stats.BytesRead += fileStat.BytesRead;
+		stats.ChunksRead += fileStat.ChunksRead;
+	}
+	stats.Seconds = static_cast<float>(FPlatformTime::Seconds() - startTime);
+	stats.BytesPerSecond = stats.Seconds > 0.0f ? static_cast<float>(stats.BytesRead / stats.Seconds) : 0.0f;
+
+	return !failed;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimeFileHelpers::HashFilesLatent(UObject* WorldContextObject, const TArray<FString>& filePaths, const ERyFileHashAlgorithm algorithm, TArray<FString>& hashes,
+                                            FRyFileStreamStats& stats, ERyAsyncFileResult& result, FLatentActionInfo LatentInfo)
+{
+	if(FRyAsyncFileLatentAction* action = RyAddAsyncFileLatentAction(WorldContextObject, LatentInfo, result))
+	{
+		struct FHashResults
+		{
+			TArray<FString> Hashes;
+			FRyFileStreamStats Stats;
+		};
+		TSharedRef<FHashResults, ESPMode::ThreadSafe> results = MakeShared<FHashResults, ESPMode::ThreadSafe>();
+		TArray<FString>* hashesOut = &hashes;
+		FRyFileStreamStats* statsOut = &stats;
+		action->ApplyOutputs = [results, hashesOut, statsOut]()
+		{
+			*hashesOut = MoveTemp(results->Hashes);
+			*statsOut = results->Stats;
+		};
+
+		action->State->RequestId = FRyAsyncFileQueue::Get().Enqueue(
+			[filePaths, algorithm, results](const FThreadSafeBool& canceled)
+			{
+				return HashFiles(filePaths, algorithm, results->Hashes, results->Stats) ? ERyAsyncFileResult::Success : ERyAsyncFileResult::Failed;
+			},
+			action->MakeCompletion());
+	}
 }
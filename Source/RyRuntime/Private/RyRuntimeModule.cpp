@@ -2,6 +2,8 @@
 
 
 #include "RyRuntimeModule.h"
+#include "RyRuntimeFileHelpers.h"
+#include "RyRuntimePlatformHelpers.h"
 
 #define LOCTEXT_NAMESPACE "RyRuntimeModule"
 
@@ -10,6 +12,8 @@
 */
 void FRyRuntimeModule::StartupModule()
 {
+	// Finish deleting directories which a previous run didn't get to
+	URyRuntimePlatformHelpers::SweepDirectoryTombstones(TArray<FString>());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -17,6 +21,8 @@ void FRyRuntimeModule::StartupModule()
 */
 void FRyRuntimeModule::ShutdownModule()
 {
+	URyRuntimeFileHelpers::ShutdownBackgroundFileWriter();
+	URyRuntimePlatformHelpers::ShutdownDirectoryDeletes();
 }
 
 #undef LOCTEXT_NAMESPACE
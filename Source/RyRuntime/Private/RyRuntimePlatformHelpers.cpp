@@ -10,6 +10,25 @@
 
 #include "Misc/App.h"
 #include "Engine/Engine.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/ScopeLock.h"
+#include "RyRuntimeFileHelpers.h"
+#include "File/RyCompiledFileFilter.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/PathViews.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Async/Async.h"
+#include "LatentActions.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "UObject/GarbageCollection.h"
+#include <atomic>
 
 #if PLATFORM_ANDROID && USE_ANDROID_JNI
 #include "Android/AndroidJNI.h"
@@ -149,12 +168,12 @@ bool DoIterateDirectory(const FString& DirectoryName, const bool IncludeSubFolde
         for(const FString& dirName : dirs)
         {
             keepGoing = FPlatformFileManager::Get().GetPlatformFile().IterateDirectory(*dirName, fileVisitor);
-            PathsOut.Append(fileVisitor.paths);
+            PathsOut.Append(MoveTemp(fileVisitor.paths));
             fileVisitor.paths.Reset();
             if(!keepGoing)
                 break;
 
-            newDirs.Append(fileVisitor.dirs);
+            newDirs.Append(MoveTemp(fileVisitor.dirs));
             fileVisitor.dirs.Reset();
         }
 
@@ -164,6 +183,311 @@ bool DoIterateDirectory(const FString& DirectoryName, const bool IncludeSubFolde
     return keepGoing;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+static void RyFillFileInfo(const TCHAR* path, const FFileStatData& statData, FRyFileInfo& info)
+{
+    info.Path = path;
+    info.Size = statData.FileSize;
+    info.CreationTime = statData.CreationTime;
+    info.AccessTime = statData.AccessTime;
+    info.ModificationTime = statData.ModificationTime;
+    info.IsDirectory = statData.bIsDirectory;
+    info.IsReadOnly = statData.bIsReadOnly;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Stat version of RyBasePlatformFileFunctor. The visitor and filter hooks of an existing functor decide what is visited
+ * and collected so both kinds of iteration behave the same.
+*/
+class RyStatPlatformFileFunctor : public IPlatformFile::FDirectoryStatVisitor
+{
+public:
+
+    RyStatPlatformFileFunctor(RyBasePlatformFileFunctor& hooksIn)
+        : hooks(hooksIn)
+    {
+    }
+
+    virtual bool Visit(const TCHAR* FilenameOrDirectory, const FFileStatData& StatData) override
+    {
+        const bool bIsDirectory = StatData.bIsDirectory;
+        const ERyIterateDirectoryOut outOption = hooks.outOption;
+        bool wasFiltered = true;
+        if(outOption == ERyIterateDirectoryOut::FilesAndDirectories ||
+           (outOption == ERyIterateDirectoryOut::DirectoriesOnly && bIsDirectory) ||
+           (outOption == ERyIterateDirectoryOut::FilesOnly && !bIsDirectory))
+        {
+            wasFiltered = hooks.DoFilter(FilenameOrDirectory);
+            if(!wasFiltered)
+            {
+                RyFillFileInfo(FilenameOrDirectory, StatData, infos.AddDefaulted_GetRef());
+            }
+        }
+
+        const bool shouldVisit = hooks.DoVisit(FilenameOrDirectory, bIsDirectory, wasFiltered);
+        if(shouldVisit && bIsDirectory)
+        {
+            dirs.Add(FilenameOrDirectory);
+        }
+
+        return shouldVisit;
+    }
+
+    RyBasePlatformFileFunctor& hooks;
+    TArray<FString> dirs;
+    TArray<FRyFileInfo> infos;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool DoIterateDirectoryStat(const FString& DirectoryName, const bool IncludeSubFolders, TArray<FRyFileInfo>& InfosOut, RyBasePlatformFileFunctor& hooks)
+{
+    RyStatPlatformFileFunctor fileVisitor(hooks);
+    int32 dirLevel = 0;
+    TArray<FString> newDirs;
+    TArray<FString> dirs;
+    dirs.Add(DirectoryName);
+    bool keepGoing = true;
+    do
+    {
+        hooks.dirLevel = dirLevel;
+        for(const FString& dirName : dirs)
+        {
+            keepGoing = FPlatformFileManager::Get().GetPlatformFile().IterateDirectoryStat(*dirName, fileVisitor);
+            InfosOut.Append(MoveTemp(fileVisitor.infos));
+            fileVisitor.infos.Reset();
+            if(!keepGoing)
+                break;
+
+            newDirs.Append(MoveTemp(fileVisitor.dirs));
+            fileVisitor.dirs.Reset();
+        }
+
+        dirs = MoveTemp(newDirs);
+        ++dirLevel;
+    } while (keepGoing && IncludeSubFolders && dirs.Num());
+    return keepGoing;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Same walk as DoIterateDirectoryStat with the filter matched natively. Excluded directories are not added to the
+ * pending list so nothing inside them is ever listed.
+*/
+bool DoIterateDirectoryFiltered(const FString& DirectoryName, const bool IncludeSubFolders, ERyIterateDirectoryOut OutType, const FRyCompiledFileFilter& Filter,
+                                TArray<FRyFileInfo>& InfosOut)
+{
+    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+    FString rootPath = DirectoryName;
+    FPaths::NormalizeDirectoryName(rootPath);
+    const int32 relativeStart = rootPath.Len() + 1;
+
+    TArray<FString> newDirs;
+    TArray<FString> dirs;
+    dirs.Add(rootPath);
+    bool keepGoing = true;
+    do
+    {
+        for(const FString& dirName : dirs)
+        {
+            keepGoing = platformFile.IterateDirectoryStat(*dirName, [&](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+            {
+                const FStringView path(FilenameOrDirectory);
+                const FStringView relativePath = path.RightChop(relativeStart);
+                const FStringView name = FPathViews::GetCleanFilename(path);
+                if(StatData.bIsDirectory)
+                {
+                    if(Filter.IsDirectoryExcluded(relativePath, name))
+                    {
+                        return true;
+                    }
+                    if(OutType != ERyIterateDirectoryOut::FilesOnly)
+                    {
+                        RyFillFileInfo(FilenameOrDirectory, StatData, InfosOut.AddDefaulted_GetRef());
+                    }
+                    newDirs.Add(FilenameOrDirectory);
+                }
+                else if(OutType != ERyIterateDirectoryOut::DirectoriesOnly && Filter.MatchesFile(relativePath, name, StatData))
+                {
+                    RyFillFileInfo(FilenameOrDirectory, StatData, InfosOut.AddDefaulted_GetRef());
+                }
+                return true;
+            });
+            if(!keepGoing)
+                break;
+        }
+
+        dirs = MoveTemp(newDirs);
+    } while (keepGoing && IncludeSubFolders && dirs.Num());
+    return keepGoing;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Visits one directory for IterateDirectoryParallel.
+ * Holds the visitor and filter by reference so state captured by them is shared between all directories.
+*/
+class RyParallelPlatformFileFunctor : public RyBasePlatformFileFunctor
+{
+public:
+
+    virtual bool DoVisit(const FString& FileOrDirectoryPath, const bool IsDirectory, const bool WasFiltered) override
+    {
+        if(halted)
+        {
+            return false;
+        }
+        if(visitor && !visitor(FileOrDirectoryPath, IsDirectory, WasFiltered, dirLevel))
+        {
+            halted = true;
+            return false;
+        }
+        return true;
+    }
+    virtual bool DoFilter(const FString& PathString) override
+    {
+        return filter ? filter(PathString) : false;
+    }
+
+    RyParallelPlatformFileFunctor(const RyNativeVisitorSig& visitorIn, const RyNativeFileFilterSig& filterIn, ERyIterateDirectoryOut OutType, FThreadSafeBool& haltedIn)
+        : RyBasePlatformFileFunctor(OutType)
+        , visitor(visitorIn)
+        , filter(filterIn)
+        , halted(haltedIn)
+    {
+    }
+
+private:
+    const RyNativeVisitorSig& visitor;
+    const RyNativeFileFilterSig& filter;
+    FThreadSafeBool& halted;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * One directory of an IterateDirectoryParallel scan. Keeps its own results so they can be merged in order at the end.
+*/
+struct FRyParallelDirNode
+{
+    FString path;
+    int32 level = 0;
+    TArray<FString> paths;
+    TArray<TUniquePtr<FRyParallelDirNode>> children;
+    bool keepGoing = true;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Shared by every directory task of an IterateDirectoryParallel scan. Lives on the calling thread's stack, which waits on
+ * DoneEvent until the last task has finished.
+*/
+struct FRyParallelDirScan
+{
+    FRyParallelDirScan(const bool includeSubFolders, ERyIterateDirectoryOut outType, const RyNativeVisitorSig& visitor, const RyNativeFileFilterSig& filter)
+        : PlatformFile(FPlatformFileManager::Get().GetPlatformFile())
+        , IncludeSubFolders(includeSubFolders)
+        , OutType(outType)
+        , Visitor(visitor)
+        , Filter(filter)
+        , Halted(false)
+        , DoneEvent(FPlatformProcess::GetSynchEventFromPool(true))
+    {
+    }
+
+    ~FRyParallelDirScan()
+    {
+        FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+    }
+
+    // Lists one directory, then launches a task for each subdirectory so the worker is free as soon as this returns
+    void ScanDirectory(FRyParallelDirNode* node)
+    {
+        RyParallelPlatformFileFunctor fileVisitor(Visitor, Filter, OutType, Halted);
+        fileVisitor.dirLevel = node->level;
+        node->keepGoing = !Halted && PlatformFile.IterateDirectory(*node->path, fileVisitor);
+        node->paths = MoveTemp(fileVisitor.paths);
+
+        if(node->keepGoing && IncludeSubFolders && fileVisitor.dirs.Num() > 0)
+        {
+            node->children.Reserve(fileVisitor.dirs.Num());
+            for(FString& dir : fileVisitor.dirs)
+            {
+                TUniquePtr<FRyParallelDirNode>& child = node->children.Add_GetRef(MakeUnique<FRyParallelDirNode>());
+                child->path = MoveTemp(dir);
+                child->level = node->level + 1;
+            }
+
+            // Counted before any child can finish, so the scan can't look done while children are still to run
+            NumUnfinished += node->children.Num();
+            for(const TUniquePtr<FRyParallelDirNode>& child : node->children)
+            {
+                FRyParallelDirNode* childNode = child.Get();
+                FFunctionGraphTask::CreateAndDispatchWhenReady([this, childNode]()
+                {
+                    ScanDirectory(childNode);
+                }, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+            }
+        }
+
+        // Nothing may touch this scan after the last directory signals, the caller is free to return
+        if(--NumUnfinished == 0)
+        {
+            DoneEvent->Trigger();
+        }
+    }
+
+    IPlatformFile& PlatformFile;
+    const bool IncludeSubFolders;
+    const ERyIterateDirectoryOut OutType;
+    const RyNativeVisitorSig& Visitor;
+    const RyNativeFileFilterSig& Filter;
+    FThreadSafeBool Halted;
+    std::atomic<int32> NumUnfinished{1};
+    FEvent* DoneEvent;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Scans the tree with one background task per directory. Each subdirectory is launched as soon as its parent has been
+ * listed, so idle workers pick it up straight away, and no worker is held once its directory is done.
+ * Every directory keeps its own results, which are merged level by level at the end so the output matches DoIterateDirectory.
+*/
+bool DoIterateDirectoryParallel(const FString& DirectoryName, const bool IncludeSubFolders, ERyIterateDirectoryOut OutType, TArray<FString>& PathsOut,
+                                const RyNativeVisitorSig& Visitor, const RyNativeFileFilterSig& Filter)
+{
+    FRyParallelDirNode root;
+    root.path = DirectoryName;
+
+    {
+        FRyParallelDirScan scan(IncludeSubFolders, OutType, Visitor, Filter);
+        // The root is listed on the calling thread, which then only waits
+        scan.ScanDirectory(&root);
+        scan.DoneEvent->Wait();
+    }
+
+    // Breadth first merge, the order DoIterateDirectory visits directories in
+    TArray<FRyParallelDirNode*> order;
+    order.Add(&root);
+    for(int32 orderIndex = 0; orderIndex < order.Num(); ++orderIndex)
+    {
+        FRyParallelDirNode* node = order[orderIndex];
+        PathsOut.Append(MoveTemp(node->paths));
+        if(!node->keepGoing)
+        {
+            return false;
+        }
+        for(const TUniquePtr<FRyParallelDirNode>& child : node->children)
+        {
+            order.Add(child.Get());
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
@@ -187,54 +511,1370 @@ bool URyRuntimePlatformHelpers::IterateDirectory(const FString& DirectoryName, c
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-FDateTime URyRuntimePlatformHelpers::GetFileTimeStamp(const FString& filePath, bool& isValid)
+bool URyRuntimePlatformHelpers::IterateDirectoryParallel(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, TArray<FString>& PathsOut,
+                                                         RyNativeVisitorSig Visitor, RyNativeFileFilterSig Filter)
+{
+    return DoIterateDirectoryParallel(DirectoryName, IterateSubFolders, OutType, PathsOut, Visitor, Filter);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::RyIterateDirectoryStat(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, TArray<FRyFileInfo>& InfosOut,
+                                                       FRyDirectoryVisitor Visitor, FRyFileFilter Filter)
+{
+    RyBPPlatformFileFunctor bpVisitor(Visitor, Filter, OutType);
+    return DoIterateDirectoryStat(DirectoryName, IterateSubFolders, InfosOut, bpVisitor);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::IterateDirectoryStat(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, TArray<FRyFileInfo>& InfosOut,
+                                                     RyNativeVisitorSig Visitor, RyNativeFileFilterSig Filter)
+{
+    RyNativePlatformFileFunctor nativeVisitor(Visitor, Filter, OutType);
+    return DoIterateDirectoryStat(DirectoryName, IterateSubFolders, InfosOut, nativeVisitor);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::IterateDirectoryFiltered(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, const FRyFileFilterSpec& Spec,
+                                                         TArray<FRyFileInfo>& InfosOut)
+{
+    const FRyCompiledFileFilter filter(Spec);
+    return DoIterateDirectoryFiltered(DirectoryName, IterateSubFolders, OutType, filter, InfosOut);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::IterateDirectoryCompiledFilter(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, const FRyCompiledFileFilter& Filter,
+                                                               TArray<FRyFileInfo>& InfosOut)
+{
+    return DoIterateDirectoryFiltered(DirectoryName, IterateSubFolders, OutType, Filter, InfosOut);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::GetFileInfo(const FString& path, FRyFileInfo& info)
+{
+    const FFileStatData statData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*path);
+    if(!statData.bIsValid)
+    {
+        info = FRyFileInfo();
+        return false;
+    }
+    RyFillFileInfo(*path, statData, info);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+URyDirectorySnapshot* URyRuntimePlatformHelpers::CaptureDirectorySnapshot(UObject* outer, const FString& rootPath, const bool recursive, bool& success)
+{
+    URyDirectorySnapshot* snapshot = NewObject<URyDirectorySnapshot>(outer);
+    success = snapshot->Capture(rootPath, recursive);
+    return snapshot;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+URyDirectorySnapshot* URyRuntimePlatformHelpers::LoadDirectorySnapshot(UObject* outer, const FString& filePath, bool& success)
+{
+    URyDirectorySnapshot* snapshot = NewObject<URyDirectorySnapshot>(outer);
+    success = snapshot->LoadFromFile(filePath);
+    return snapshot;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyDirectorySnapshot::Capture(const FString& rootPath, const bool recursive)
+{
+    RootPath = rootPath;
+    FPaths::NormalizeDirectoryName(RootPath);
+    Recursive = recursive;
+
+    TMap<FString, FDirEntry> newDirs;
+    const bool success = Scan(false, newDirs);
+    Dirs = MoveTemp(newDirs);
+    return success;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyDirectorySnapshot::Refresh(FRyDirectorySnapshotDiff& diff, const bool onlyChangedDirectories)
+{
+    diff.Added.Reset();
+    diff.Removed.Reset();
+    diff.Modified.Reset();
+
+    TMap<FString, FDirEntry> newDirs;
+    const bool success = Scan(onlyChangedDirectories, newDirs);
+
+    for(const TPair<FString, FDirEntry>& newDir : newDirs)
+    {
+        const FDirEntry* oldDir = Dirs.Find(newDir.Key);
+        for(const TPair<FString, FFileEntry>& newFile : newDir.Value.Files)
+        {
+            const FFileEntry* oldFile = oldDir ? oldDir->Files.Find(newFile.Key) : nullptr;
+            if(!oldFile)
+            {
+                diff.Added.Add(MakeFullPath(newDir.Key, newFile.Key));
+            }
+            else if(oldFile->Size != newFile.Value.Size || oldFile->ModificationTicks != newFile.Value.ModificationTicks)
+            {
+                diff.Modified.Add(MakeFullPath(newDir.Key, newFile.Key));
+            }
+        }
+
+        if(oldDir)
+        {
+            for(const TPair<FString, FFileEntry>& oldFile : oldDir->Files)
+            {
+                if(!newDir.Value.Files.Contains(oldFile.Key))
+                {
+                    diff.Removed.Add(MakeFullPath(newDir.Key, oldFile.Key));
+                }
+            }
+        }
+    }
+
+    // Everything in directories which are gone was removed
+    for(const TPair<FString, FDirEntry>& oldDir : Dirs)
+    {
+        if(!newDirs.Contains(oldDir.Key))
+        {
+            for(const TPair<FString, FFileEntry>& oldFile : oldDir.Value.Files)
+            {
+                diff.Removed.Add(MakeFullPath(oldDir.Key, oldFile.Key));
+            }
+        }
+    }
+
+    Dirs = MoveTemp(newDirs);
+    return success;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyDirectorySnapshot::Scan(const bool onlyChangedDirectories, TMap<FString, FDirEntry>& dirsOut) const
 {
     IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
-    isValid = FileExists(filePath);
-    return isValid ? platformFile.GetTimeStamp(*filePath) : FDateTime(0);
+    TArray<FString> pending;
+    pending.Add(FString());
+    for(int32 pendingIndex = 0; pendingIndex < pending.Num(); ++pendingIndex)
+    {
+        const FString relativeDir = pending[pendingIndex];
+        const FString fullDir = relativeDir.IsEmpty() ? RootPath : RootPath / relativeDir;
+        const FFileStatData dirStat = platformFile.GetStatData(*fullDir);
+        if(!dirStat.bIsValid || !dirStat.bIsDirectory)
+        {
+            if(pendingIndex == 0)
+            {
+                return false;
+            }
+            // Removed between listing its parent and getting here
+            continue;
+        }
+
+        const int64 modificationTicks = dirStat.ModificationTime.GetTicks();
+        const FDirEntry* oldDir = onlyChangedDirectories ? Dirs.Find(relativeDir) : nullptr;
+        FDirEntry& dir = dirsOut.Add(relativeDir);
+        if(oldDir && oldDir->ModificationTicks == modificationTicks)
+        {
+            dir = *oldDir;
+        }
+        else
+        {
+            dir.ModificationTicks = modificationTicks;
+            platformFile.IterateDirectoryStat(*fullDir, [&dir](const TCHAR* path, const FFileStatData& statData)
+            {
+                FString name = FPaths::GetCleanFilename(path);
+                if(statData.bIsDirectory)
+                {
+                    dir.SubDirs.Add(MoveTemp(name));
+                }
+                else
+                {
+                    FFileEntry& file = dir.Files.Add(MoveTemp(name));
+                    file.Size = statData.FileSize;
+                    file.ModificationTicks = statData.ModificationTime.GetTicks();
+                }
+                return true;
+            });
+        }
+
+        if(Recursive)
+        {
+            for(const FString& subDir : dir.SubDirs)
+            {
+                pending.Add(relativeDir.IsEmpty() ? subDir : relativeDir / subDir);
+            }
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FString URyDirectorySnapshot::MakeFullPath(const FString& relativeDir, const FString& name) const
+{
+    return relativeDir.IsEmpty() ? RootPath / name : RootPath / relativeDir / name;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Snapshot file layout:
+ * uint32 Magic, uint32 Version, FString RootPath, bool Recursive, int32 NumDirs, then per directory:
+ * FString RelativePath, int64 ModificationTicks, TArray<FString> SubDirs, int32 NumFiles, then per file:
+ * FString Name, int64 Size, int64 ModificationTicks
+*/
+void URyDirectorySnapshot::SerializeSnapshot(FArchive& ar)
+{
+    int32 numDirs = Dirs.Num();
+    ar << RootPath;
+    ar << Recursive;
+    ar << numDirs;
+
+    if(ar.IsLoading())
+    {
+        Dirs.Reset();
+        Dirs.Reserve(numDirs);
+        for(int32 dirIndex = 0; dirIndex < numDirs && !ar.IsError(); ++dirIndex)
+        {
+            FString relativeDir;
+            ar << relativeDir;
+            FDirEntry& dir = Dirs.Add(MoveTemp(relativeDir));
+            ar << dir.ModificationTicks;
+            ar << dir.SubDirs;
+
+            int32 numFiles = 0;
+            ar << numFiles;
+            dir.Files.Reserve(numFiles);
+            for(int32 fileIndex = 0; fileIndex < numFiles && !ar.IsError(); ++fileIndex)
+            {
+                FString name;
+                ar << name;
+                FFileEntry& file = dir.Files.Add(MoveTemp(name));
+                ar << file.Size;
+                ar << file.ModificationTicks;
+            }
+        }
+        return;
+    }
+
+    for(TPair<FString, FDirEntry>& dir : Dirs)
+    {
+        ar << dir.Key;
+        ar << dir.Value.ModificationTicks;
+        ar << dir.Value.SubDirs;
+
+        int32 numFiles = dir.Value.Files.Num();
+        ar << numFiles;
+        for(TPair<FString, FFileEntry>& file : dir.Value.Files)
+        {
+            ar << file.Key;
+            ar << file.Value.Size;
+            ar << file.Value.ModificationTicks;
+        }
+    }
+}
+
+namespace RyDirectorySnapshotFile
+{
+    constexpr uint32 Magic = 0x53445952; // RYDS
+    constexpr uint32 Version = 1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyDirectorySnapshot::SaveToFile(const FString& filePath) const
+{
+    TArray<uint8> bytes;
+    FMemoryWriter writer(bytes);
+    uint32 magic = RyDirectorySnapshotFile::Magic;
+    uint32 version = RyDirectorySnapshotFile::Version;
+    writer << magic;
+    writer << version;
+    const_cast<URyDirectorySnapshot*>(this)->SerializeSnapshot(writer);
+    return URyRuntimeFileHelpers::WriteBytesToFileAtomic(filePath, true, bytes);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyDirectorySnapshot::LoadFromFile(const FString& filePath)
+{
+    TArray<uint8> bytes;
+    if(!FFileHelper::LoadFileToArray(bytes, *filePath, FILEREAD_Silent))
+    {
+        return false;
+    }
+
+    FMemoryReader reader(bytes);
+    uint32 magic = 0;
+    uint32 version = 0;
+    reader << magic;
+    reader << version;
+    if(reader.IsError() || magic != RyDirectorySnapshotFile::Magic || version != RyDirectorySnapshotFile::Version)
+    {
+        UE_LOG(LogRyRuntime, Warning, TEXT("URyDirectorySnapshot::LoadFromFile: %s is not a directory snapshot"), *filePath);
+        return false;
+    }
+
+    SerializeSnapshot(reader);
+    if(reader.IsError())
+    {
+        UE_LOG(LogRyRuntime, Warning, TEXT("URyDirectorySnapshot::LoadFromFile: %s is truncated or corrupt"), *filePath);
+        RootPath.Reset();
+        Dirs.Reset();
+        return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyDirectorySnapshot::GetNumFiles() const
+{
+    int32 numFiles = 0;
+    for(const TPair<FString, FDirEntry>& dir : Dirs)
+    {
+        numFiles += dir.Value.Files.Num();
+    }
+    return numFiles;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+TArray<FString> URyDirectorySnapshot::GetFilePaths() const
+{
+    TArray<FString> paths;
+    paths.Reserve(GetNumFiles());
+    for(const TPair<FString, FDirEntry>& dir : Dirs)
+    {
+        for(const TPair<FString, FFileEntry>& file : dir.Value.Files)
+        {
+            paths.Add(MakeFullPath(dir.Key, file.Key));
+        }
+    }
+    return paths;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Storage for registered named events and stats. Entries are never removed or moved so handles can keep raw pointers
+ * to their strings, and the slot array never reallocates so lookups by id need no lock.
+*/
+class FRyNamedProfilerRegistry
+{
+public:
+
+    struct FEntry
+    {
+        FString Text;
+        FString Graph;
+        FString Unit;
+        FColor Color;
+    };
+
+    static constexpr int32 MaxEntries = 4096;
+
+    static FRyNamedProfilerRegistry& Get()
+    {
+        static FRyNamedProfilerRegistry Registry;
+        return Registry;
+    }
+
+    ~FRyNamedProfilerRegistry()
+    {
+        for(int32 entryIndex = 0; entryIndex < NumEntries; ++entryIndex)
+        {
+            delete Entries[entryIndex];
+        }
+    }
+
+    int32 Register(const FString& key, const FString& text, const FString& graph, const FString& unit, const FColor& color)
+    {
+        FScopeLock lock(&Lock);
+        if(const int32* existing = Lookup.Find(key))
+        {
+            return *existing;
+        }
+
+        const int32 entryIndex = NumEntries.load(std::memory_order_relaxed);
+        if(entryIndex >= MaxEntries)
+        {
+            UE_LOG(LogRyRuntime, Warning, TEXT("FRyNamedProfilerRegistry: More than %d named events and stats, %s was not registered"), MaxEntries, *text);
+            return INDEX_NONE;
+        }
+
+        Entries[entryIndex] = new FEntry{text, graph, unit, color};
+        Lookup.Add(key, entryIndex);
+        NumEntries.store(entryIndex + 1, std::memory_order_release);
+        return entryIndex;
+    }
+
+    const FEntry* Find(const int32 entryIndex) const
+    {
+        return (entryIndex >= 0 && entryIndex < NumEntries.load(std::memory_order_acquire)) ? Entries[entryIndex] : nullptr;
+    }
+
+private:
+
+    FEntry* Entries[MaxEntries] = {};
+    std::atomic<int32> NumEntries{0};
+    FCriticalSection Lock;
+    TMap<FString, int32> Lookup;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FRyNamedEventHandle URyRuntimePlatformHelpers::RegisterNamedEvent(const FColor& Color, const FString& Text)
+{
+    FRyNamedProfilerRegistry& registry = FRyNamedProfilerRegistry::Get();
+    FRyNamedEventHandle handle;
+    handle.Id = registry.Register(FString::Printf(TEXT("E|%s|%08x"), *Text, Color.ToPackedARGB()), Text, FString(), FString(), Color);
+    if(const FRyNamedProfilerRegistry::FEntry* entry = registry.Find(handle.Id))
+    {
+        handle.Text = *entry->Text;
+        handle.Color = entry->Color;
+    }
+    return handle;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::BeginNamedEventHandle(const FRyNamedEventHandle& Handle)
+{
+    if(Handle.Text)
+    {
+        FPlatformMisc::BeginNamedEvent(Handle.Color, Handle.Text);
+    }
+    else if(const FRyNamedProfilerRegistry::FEntry* entry = FRyNamedProfilerRegistry::Get().Find(Handle.Id))
+    {
+        FPlatformMisc::BeginNamedEvent(entry->Color, *entry->Text);
+    }
+    else
+    {
+        // Keep Begin and End balanced for callers which always call EndNamedEvent
+        FPlatformMisc::BeginNamedEvent(FColor::White, TEXT("UnregisteredNamedEvent"));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FRyNamedStatHandle URyRuntimePlatformHelpers::RegisterNamedStat(const FString& Text, const FString& Graph, const FString& Unit)
+{
+    FRyNamedProfilerRegistry& registry = FRyNamedProfilerRegistry::Get();
+    FRyNamedStatHandle handle;
+    handle.Id = registry.Register(FString::Printf(TEXT("S|%s|%s|%s"), *Text, *Graph, *Unit), Text, Graph, Unit, FColor::White);
+    if(const FRyNamedProfilerRegistry::FEntry* entry = registry.Find(handle.Id))
+    {
+        handle.Text = *entry->Text;
+        handle.Graph = *entry->Graph;
+        handle.Unit = *entry->Unit;
+    }
+    return handle;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::CustomNamedStatHandle(const FRyNamedStatHandle& Handle, const float Value)
+{
+    if(Handle.Text)
+    {
+        FPlatformMisc::CustomNamedStat(Handle.Text, Value, Handle.Graph, Handle.Unit);
+    }
+    else if(const FRyNamedProfilerRegistry::FEntry* entry = FRyNamedProfilerRegistry::Get().Find(Handle.Id))
+    {
+        FPlatformMisc::CustomNamedStat(*entry->Text, Value, *entry->Graph, *entry->Unit);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Runtime defined trace counters, scopes and the channels grouping them. Like FRyNamedProfilerRegistry the slots never
+ * move so emitting a value only reads atomics, the lock is only taken to register.
+*/
+class FRyTraceRegistry
+{
+public:
+
+    struct FCounter
+    {
+        FString Name;
+        int32 ChannelIndex = 0;
+        bool IsFloat = false;
+        bool IsMemory = false;
+        // The id the trace gave the counter, 0 until it is first set while tracing
+        std::atomic<uint16> TraceId{0};
+        std::atomic<int64> IntValue{0};
+    };
+
+    struct FScope
+    {
+        FString Name;
+        int32 ChannelIndex = 0;
+        // The trace event type of the scope, 0 until it is first begun while tracing
+        std::atomic<uint32> SpecId{0};
+    };
+
+    static constexpr int32 MaxCounters = 1024;
+    static constexpr int32 MaxScopes = 4096;
+    static constexpr int32 MaxChannels = 256;
+
+    static FRyTraceRegistry& Get()
+    {
+        static FRyTraceRegistry Registry;
+        return Registry;
+    }
+
+    ~FRyTraceRegistry()
+    {
+        for(int32 counterIndex = 0; counterIndex < NumCounters; ++counterIndex)
+        {
+            delete Counters[counterIndex];
+        }
+        for(int32 scopeIndex = 0; scopeIndex < NumScopes; ++scopeIndex)
+        {
+            delete Scopes[scopeIndex];
+        }
+    }
+
+    int32 RegisterCounter(const FString& name, const bool isFloat, const bool isMemory, const FName channel)
+    {
+        FScopeLock lock(&Lock);
+        if(const int32* existing = CounterLookup.Find(name))
+        {
+            return *existing;
+        }
+        const int32 counterIndex = NumCounters.load(std::memory_order_relaxed);
+        if(counterIndex >= MaxCounters)
+        {
+            UE_LOG(LogRyRuntime, Warning, TEXT("FRyTraceRegistry: More than %d trace counters, %s was not registered"), MaxCounters, *name);
+            return INDEX_NONE;
+        }
+
+        FCounter* counter = new FCounter();
+        counter->Name = name;
+        counter->ChannelIndex = FindOrAddChannel(channel);
+        counter->IsFloat = isFloat;
+        counter->IsMemory = isMemory;
+        Counters[counterIndex] = counter;
+        CounterLookup.Add(name, counterIndex);
+        NumCounters.store(counterIndex + 1, std::memory_order_release);
+        return counterIndex;
+    }
+
+    int32 RegisterScope(const FString& name, const FName channel)
+    {
+        FScopeLock lock(&Lock);
+        if(const int32* existing = ScopeLookup.Find(name))
+        {
+            return *existing;
+        }
+        const int32 scopeIndex = NumScopes.load(std::memory_order_relaxed);
+        if(scopeIndex >= MaxScopes)
+        {
+            UE_LOG(LogRyRuntime, Warning, TEXT("FRyTraceRegistry: More than %d trace scopes, %s was not registered"), MaxScopes, *name);
+            return INDEX_NONE;
+        }
+
+        FScope* scope = new FScope();
+        scope->Name = name;
+        scope->ChannelIndex = FindOrAddChannel(channel);
+        Scopes[scopeIndex] = scope;
+        ScopeLookup.Add(name, scopeIndex);
+        NumScopes.store(scopeIndex + 1, std::memory_order_release);
+        return scopeIndex;
+    }
+
+    FCounter* FindCounter(const int32 counterIndex) const
+    {
+        return (counterIndex >= 0 && counterIndex < NumCounters.load(std::memory_order_acquire)) ? Counters[counterIndex] : nullptr;
+    }
+
+    FScope* FindScope(const int32 scopeIndex) const
+    {
+        return (scopeIndex >= 0 && scopeIndex < NumScopes.load(std::memory_order_acquire)) ? Scopes[scopeIndex] : nullptr;
+    }
+
+    void SetChannelEnabled(const FName channel, const bool enabled)
+    {
+        FScopeLock lock(&Lock);
+        const int32 channelIndex = FindOrAddChannel(channel);
+        if(channelIndex != INDEX_NONE)
+        {
+            ChannelEnabled[channelIndex].store(enabled, std::memory_order_relaxed);
+        }
+    }
+
+    bool IsChannelEnabled(const FName channel)
+    {
+        FScopeLock lock(&Lock);
+        const int32* channelIndex = ChannelLookup.Find(channel);
+        return !channelIndex || ChannelEnabled[*channelIndex].load(std::memory_order_relaxed);
+    }
+
+    bool IsChannelEnabled(const int32 channelIndex) const
+    {
+        return channelIndex == INDEX_NONE || ChannelEnabled[channelIndex].load(std::memory_order_relaxed);
+    }
+
+private:
+
+    FRyTraceRegistry()
+    {
+        for(std::atomic<bool>& enabled : ChannelEnabled)
+        {
+            enabled.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    // Lock must be held
+    int32 FindOrAddChannel(const FName channel)
+    {
+        if(const int32* existing = ChannelLookup.Find(channel))
+        {
+            return *existing;
+        }
+        if(ChannelLookup.Num() >= MaxChannels)
+        {
+            return INDEX_NONE;
+        }
+        return ChannelLookup.Add(channel, ChannelLookup.Num());
+    }
+
+    FCounter* Counters[MaxCounters] = {};
+    FScope* Scopes[MaxScopes] = {};
+    std::atomic<int32> NumCounters{0};
+    std::atomic<int32> NumScopes{0};
+    std::atomic<bool> ChannelEnabled[MaxChannels];
+
+    FCriticalSection Lock;
+    TMap<FString, int32> CounterLookup;
+    TMap<FString, int32> ScopeLookup;
+    TMap<FName, int32> ChannelLookup;
+};
+
+#if COUNTERSTRACE_ENABLED
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Announce the counter to the trace the first time it is used while tracing
+*/
+static uint16 RyGetTraceCounterId(FRyTraceRegistry::FCounter& counter)
+{
+    uint16 traceId = counter.TraceId.load(std::memory_order_relaxed);
+    if(traceId == 0)
+    {
+        traceId = FCountersTrace::OutputInitCounter(*counter.Name, counter.IsFloat ? TraceCounterType_Float : TraceCounterType_Int,
+                                                    counter.IsMemory ? TraceCounterDisplayHint_Memory : TraceCounterDisplayHint_None);
+        counter.TraceId.store(traceId, std::memory_order_relaxed);
+    }
+    return traceId;
+}
+#endif
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FRyTraceCounterHandle URyRuntimePlatformHelpers::RegisterTraceCounter(const FString& Name, const bool IsFloat, const bool IsMemory, const FName Channel)
+{
+    FRyTraceCounterHandle handle;
+    handle.Id = FRyTraceRegistry::Get().RegisterCounter(Name, IsFloat, IsMemory, Channel);
+    return handle;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::SetTraceCounterInt(const FRyTraceCounterHandle& Handle, const int64 Value)
+{
+    FRyTraceRegistry& registry = FRyTraceRegistry::Get();
+    FRyTraceRegistry::FCounter* counter = registry.FindCounter(Handle.Id);
+    if(!counter)
+    {
+        return;
+    }
+    counter->IntValue.store(Value, std::memory_order_relaxed);
+#if COUNTERSTRACE_ENABLED
+    if(UE_TRACE_CHANNELEXPR_IS_ENABLED(CountersChannel) && registry.IsChannelEnabled(counter->ChannelIndex))
+    {
+        FCountersTrace::OutputSetValue(RyGetTraceCounterId(*counter), Value);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::AddTraceCounterInt(const FRyTraceCounterHandle& Handle, const int64 Amount)
+{
+    FRyTraceRegistry& registry = FRyTraceRegistry::Get();
+    FRyTraceRegistry::FCounter* counter = registry.FindCounter(Handle.Id);
+    if(!counter)
+    {
+        return;
+    }
+    const int64 value = counter->IntValue.fetch_add(Amount, std::memory_order_relaxed) + Amount;
+#if COUNTERSTRACE_ENABLED
+    if(UE_TRACE_CHANNELEXPR_IS_ENABLED(CountersChannel) && registry.IsChannelEnabled(counter->ChannelIndex))
+    {
+        FCountersTrace::OutputSetValue(RyGetTraceCounterId(*counter), value);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::SetTraceCounterFloat(const FRyTraceCounterHandle& Handle, const float Value)
+{
+#if COUNTERSTRACE_ENABLED
+    FRyTraceRegistry& registry = FRyTraceRegistry::Get();
+    FRyTraceRegistry::FCounter* counter = registry.FindCounter(Handle.Id);
+    if(counter && UE_TRACE_CHANNELEXPR_IS_ENABLED(CountersChannel) && registry.IsChannelEnabled(counter->ChannelIndex))
+    {
+        FCountersTrace::OutputSetValue(RyGetTraceCounterId(*counter), static_cast<double>(Value));
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FRyTraceScopeHandle URyRuntimePlatformHelpers::RegisterTraceScope(const FString& Name, const FName Channel)
+{
+    FRyTraceScopeHandle handle;
+    handle.Id = FRyTraceRegistry::Get().RegisterScope(Name, Channel);
+    return handle;
+}
+
+// Per thread record of which begun scopes were sent to the trace, so End only closes events Begin actually opened
+static thread_local TArray<bool> GRyTraceScopeStack;
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::BeginTraceScope(const FRyTraceScopeHandle& Handle)
+{
+    bool traced = false;
+#if CPUPROFILERTRACE_ENABLED
+    FRyTraceRegistry& registry = FRyTraceRegistry::Get();
+    FRyTraceRegistry::FScope* scope = registry.FindScope(Handle.Id);
+    if(scope && UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel) && registry.IsChannelEnabled(scope->ChannelIndex))
+    {
+        uint32 specId = scope->SpecId.load(std::memory_order_relaxed);
+        if(specId == 0)
+        {
+            specId = FCpuProfilerTrace::OutputEventType(*scope->Name);
+            scope->SpecId.store(specId, std::memory_order_relaxed);
+        }
+        FCpuProfilerTrace::OutputBeginEvent(specId);
+        traced = true;
+    }
+#endif
+    GRyTraceScopeStack.Push(traced);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::EndTraceScope()
+{
+    if(GRyTraceScopeStack.Num() == 0)
+    {
+        return;
+    }
+    const bool traced = GRyTraceScopeStack.Pop();
+#if CPUPROFILERTRACE_ENABLED
+    if(traced)
+    {
+        FCpuProfilerTrace::OutputEndEvent();
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::BeginTraceRegion(const FString& Name)
+{
+#if MISCTRACE_ENABLED && (ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1))
+    FMiscTrace::OutputBeginRegion(*Name);
+#endif
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::EndTraceRegion(const FString& Name)
+{
+#if MISCTRACE_ENABLED && (ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1))
+    FMiscTrace::OutputEndRegion(*Name);
+#endif
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::SetTraceChannelEnabled(const FName Channel, const bool Enabled)
+{
+    FRyTraceRegistry::Get().SetChannelEnabled(Channel, Enabled);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::IsTraceChannelEnabled(const FName Channel)
+{
+    return FRyTraceRegistry::Get().IsChannelEnabled(Channel);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FDateTime URyRuntimePlatformHelpers::GetFileTimeStamp(const FString& filePath, bool& isValid)
+{
+    // One stat call instead of FileExists followed by GetTimeStamp
+    const FFileStatData statData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*filePath);
+    isValid = statData.bIsValid && !statData.bIsDirectory;
+    return isValid ? statData.ModificationTime : FDateTime(0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+FText URyRuntimePlatformHelpers::GetFileTimeStampText(const FString& filePath, bool& isValid, const bool longName)
+{
+    FDateTime FileTimeStamp = GetFileTimeStamp(filePath, isValid);
+    if(!isValid)
+    {
+        return FText::FromString(TEXT("INVALID"));
+    }
+    const FTimespan UTCOffset = FDateTime::Now() - FDateTime::UtcNow();
+    FileTimeStamp += UTCOffset;
+    if(longName)
+    {
+        return FText::AsDateTime(FileTimeStamp, EDateTimeStyle::Long, EDateTimeStyle::Medium, FText::GetInvariantTimeZone());
+    } 
+    return FText::AsDateTime(FileTimeStamp, EDateTimeStyle::Short, EDateTimeStyle::Short,FText::GetInvariantTimeZone());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::DeleteFile(const FString& filePath)
+{
+    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+    return platformFile.DeleteFile(*filePath);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::DeleteDirectory(const FString& directoryPath, const bool recursive)
+{
+    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if(recursive)
+    {
+        return platformFile.DeleteDirectoryRecursively(*directoryPath);
+    }
+    return platformFile.DeleteDirectory(*directoryPath);
+}
+
+namespace RyTombstone
+{
+    const TCHAR* const Extension = TEXT(".rytombstone");
+
+    // Tombstones are recorded here so the startup sweep can find them wherever they are
+    FString GetManifestPath()
+    {
+        return FPaths::ProjectSavedDir() / TEXT("RyTombstones.txt");
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Deletes one tombstone directory, files first and then directories deepest first, so it can stop between files
+ * and report progress, which DeleteDirectoryRecursively can't.
+*/
+class FRyTombstoneDelete : public TSharedFromThis<FRyTombstoneDelete, ESPMode::ThreadSafe>
+{
+public:
+
+    FRyTombstoneDelete(const int32 deleteId, const FString& tombstonePath, RyNativeDeleteCompleteSig onComplete)
+        : Id(deleteId)
+        , TombstonePath(tombstonePath)
+        , OnComplete(MoveTemp(onComplete))
+        , StartTime(FPlatformTime::Seconds())
+        , EndTime(0.0)
+        , Succeeded(false)
+    {
+    }
+
+    void Run()
+    {
+        // Canceled while still queued, leave the tombstone for the next sweep
+        if(Canceled)
+        {
+            EndTime = FPlatformTime::Seconds();
+            Done = true;
+            return;
+        }
+
+        IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+        TArray<FRyFileInfo> infos;
+        URyRuntimePlatformHelpers::IterateDirectoryStat(TombstonePath, true, ERyIterateDirectoryOut::FilesAndDirectories, infos);
+
+        int64 totalBytes = 0;
+        int32 totalFiles = 0;
+        for(const FRyFileInfo& info : infos)
+        {
+            if(!info.IsDirectory)
+            {
+                totalBytes += info.Size;
+                ++totalFiles;
+            }
+        }
+        TotalBytes = totalBytes;
+        TotalFiles = totalFiles;
+
+        for(const FRyFileInfo& info : infos)
+        {
+            if(Canceled)
+                break;
+            if(info.IsDirectory)
+                continue;
+
+            bool deleted = platformFile.DeleteFile(*info.Path);
+            if(!deleted && info.IsReadOnly)
+            {
+                platformFile.SetReadOnly(*info.Path, false);
+                deleted = platformFile.DeleteFile(*info.Path);
+            }
+            if(deleted)
+            {
+                ++FilesDeleted;
+                BytesDeleted += info.Size;
+            }
+        }
+
+        // Iteration lists parents before children, so walking backwards deletes children first
+        for(int32 infoIndex = infos.Num() - 1; infoIndex >= 0 && !Canceled; --infoIndex)
+        {
+            if(infos[infoIndex].IsDirectory)
+            {
+                platformFile.DeleteDirectory(*infos[infoIndex].Path);
+            }
+        }
+
+        if(!Canceled)
+        {
+            platformFile.DeleteDirectory(*TombstonePath);
+        }
+        Succeeded = !Canceled && !platformFile.DirectoryExists(*TombstonePath);
+        EndTime = FPlatformTime::Seconds();
+        Done = true;
+    }
+
+    void Cancel() { Canceled = true; }
+    bool IsDone() const { return Done; }
+    bool HasSucceeded() const { return Done && Succeeded; }
+
+    FRyDeleteProgress GetProgress() const
+    {
+        FRyDeleteProgress progress;
+        progress.FilesDeleted = FilesDeleted;
+        progress.TotalFiles = TotalFiles;
+        progress.BytesDeleted = BytesDeleted;
+        progress.TotalBytes = TotalBytes;
+        progress.Done = Done;
+        progress.Seconds = static_cast<float>((Done ? EndTime : FPlatformTime::Seconds()) - StartTime);
+        return progress;
+    }
+
+    const int32 Id;
+    const FString TombstonePath;
+    RyNativeDeleteCompleteSig OnComplete;
+
+private:
+
+    const double StartTime;
+    double EndTime;
+    bool Succeeded;
+
+    std::atomic<int32> FilesDeleted{0};
+    std::atomic<int32> TotalFiles{0};
+    std::atomic<int64> BytesDeleted{0};
+    std::atomic<int64> TotalBytes{0};
+    FThreadSafeBool Canceled{false};
+    FThreadSafeBool Done{false};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Owns the queued and running tombstone deletes. A couple of dedicated threads work through the queue so long deletes
+ * don't hold up the thread pool, and a startup sweep of many tombstones doesn't start a thread for each one.
+*/
+class FRyTombstoneDeleter
+{
+public:
+
+    static constexpr int32 MaxWorkers = 2;
+
+    static FRyTombstoneDeleter& Get()
+    {
+        static FRyTombstoneDeleter Deleter;
+        return Deleter;
+    }
+
+    TSharedRef<FRyTombstoneDelete, ESPMode::ThreadSafe> Start(const FString& tombstonePath, RyNativeDeleteCompleteSig onComplete)
+    {
+        RecordTombstone(tombstonePath);
+
+        FScopeLock lock(&Lock);
+        TSharedRef<FRyTombstoneDelete, ESPMode::ThreadSafe> deleteOp = MakeShared<FRyTombstoneDelete, ESPMode::ThreadSafe>(NextId++, tombstonePath, MoveTemp(onComplete));
+        Active.Add(deleteOp->Id, deleteOp);
+        Pending.Add(deleteOp);
+
+        if(NumWorkers < MaxWorkers)
+        {
+            ++NumWorkers;
+            Workers.RemoveAll([](const TFuture<void>& worker) { return worker.IsReady(); });
+            Workers.Add(Async(EAsyncExecution::Thread, [this]() { RunWorker(); }));
+        }
+        return deleteOp;
+    }
+
+    TSharedPtr<FRyTombstoneDelete, ESPMode::ThreadSafe> Find(const int32 deleteId)
+    {
+        FScopeLock lock(&Lock);
+        const TSharedRef<FRyTombstoneDelete, ESPMode::ThreadSafe>* deleteOp = Active.Find(deleteId);
+        return deleteOp ? TSharedPtr<FRyTombstoneDelete, ESPMode::ThreadSafe>(*deleteOp) : nullptr;
+    }
+
+    bool IsActive(const FString& tombstonePath)
+    {
+        FScopeLock lock(&Lock);
+        for(const TPair<int32, TSharedRef<FRyTombstoneDelete, ESPMode::ThreadSafe>>& deleteOp : Active)
+        {
+            if(deleteOp.Value->TombstonePath == tombstonePath)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Remove every recorded tombstone from the manifest and return them
+    TArray<FString> TakeRecordedTombstones()
+    {
+        FScopeLock lock(&ManifestLock);
+        TArray<FString> tombstones;
+        const FString manifestPath = RyTombstone::GetManifestPath();
+        if(FFileHelper::LoadFileToStringArray(tombstones, *manifestPath))
+        {
+            FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*manifestPath);
+        }
+        return tombstones;
+    }
+
+    void Shutdown()
+    {
+        TArray<TFuture<void>> workers;
+        {
+            FScopeLock lock(&Lock);
+            for(const TPair<int32, TSharedRef<FRyTombstoneDelete, ESPMode::ThreadSafe>>& deleteOp : Active)
+            {
+                deleteOp.Value->Cancel();
+            }
+            workers = MoveTemp(Workers);
+        }
+        // Canceled deletes still in the queue finish straight away, so the workers drain it quickly
+        for(const TFuture<void>& worker : workers)
+        {
+            worker.Wait();
+        }
+    }
+
+private:
+
+    void RunWorker()
+    {
+        for(;;)
+        {
+            TSharedPtr<FRyTombstoneDelete, ESPMode::ThreadSafe> deleteOp;
+            {
+                FScopeLock lock(&Lock);
+                if(Pending.Num() == 0)
+                {
+                    --NumWorkers;
+                    return;
+                }
+                deleteOp = Pending[0];
+                Pending.RemoveAt(0);
+            }
+            deleteOp->Run();
+            Finish(deleteOp.ToSharedRef());
+        }
+    }
+
+    void RecordTombstone(const FString& tombstonePath)
+    {
+        FScopeLock lock(&ManifestLock);
+        FFileHelper::SaveStringToFile(tombstonePath + LINE_TERMINATOR, *RyTombstone::GetManifestPath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+                                      &IFileManager::Get(), FILEWRITE_Append);
+    }
+
+    void RemoveRecordedTombstone(const FString& tombstonePath)
+    {
+        FScopeLock lock(&ManifestLock);
+        const FString manifestPath = RyTombstone::GetManifestPath();
+        TArray<FString> tombstones;
+        if(!FFileHelper::LoadFileToStringArray(tombstones, *manifestPath))
+        {
+            return;
+        }
+
+        tombstones.Remove(tombstonePath);
+        if(tombstones.Num() == 0)
+        {
+            FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*manifestPath);
+        }
+        else
+        {
+            FFileHelper::SaveStringArrayToFile(tombstones, *manifestPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+        }
+    }
+
+    void Finish(const TSharedRef<FRyTombstoneDelete, ESPMode::ThreadSafe>& deleteOp)
+    {
+        // Failed or canceled tombstones stay in the manifest for the next sweep
+        if(deleteOp->HasSucceeded())
+        {
+            RemoveRecordedTombstone(deleteOp->TombstonePath);
+        }
+
+        {
+            FScopeLock lock(&Lock);
+            Active.Remove(deleteOp->Id);
+        }
+        if(deleteOp->OnComplete)
+        {
+            AsyncTask(ENamedThreads::GameThread, [deleteOp]()
+            {
+                deleteOp->OnComplete(deleteOp->HasSucceeded());
+            });
+        }
+    }
+
+    FCriticalSection Lock;
+    FCriticalSection ManifestLock;
+    TMap<int32, TSharedRef<FRyTombstoneDelete, ESPMode::ThreadSafe>> Active;
+    TArray<TSharedRef<FRyTombstoneDelete, ESPMode::ThreadSafe>> Pending;
+    TArray<TFuture<void>> Workers;
+    int32 NumWorkers = 0;
+    int32 NextId = 1;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Rename a directory to a tombstone and queue its delete.
+ * @return Null if the directory doesn't exist or couldn't be renamed
+*/
+static TSharedPtr<FRyTombstoneDelete, ESPMode::ThreadSafe> RyStartDirectoryDelete(const FString& directoryPath, RyNativeDeleteCompleteSig onComplete)
+{
+    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+    FString path = directoryPath;
+    FPaths::NormalizeDirectoryName(path);
+    if(!platformFile.DirectoryExists(*path))
+    {
+        return nullptr;
+    }
+
+    // Renaming next to the original stays on the same drive, so it is a quick rename and never a copy
+    const FString tombstonePath = FString::Printf(TEXT("%s.%s%s"), *path, *FGuid::NewGuid().ToString(), RyTombstone::Extension);
+    if(!platformFile.MoveFile(*tombstonePath, *path))
+    {
+        UE_LOG(LogRyRuntime, Warning, TEXT("DeleteDirectoryAsync: Couldn't rename %s to a tombstone"), *path);
+        return nullptr;
+    }
+
+    return FRyTombstoneDeleter::Get().Start(tombstonePath, MoveTemp(onComplete));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+int32 URyRuntimePlatformHelpers::DeleteDirectoryAsync(const FString& directoryPath, RyNativeDeleteCompleteSig onComplete)
+{
+    const TSharedPtr<FRyTombstoneDelete, ESPMode::ThreadSafe> deleteOp = RyStartDirectoryDelete(directoryPath, MoveTemp(onComplete));
+    return deleteOp.IsValid() ? deleteOp->Id : 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::DeleteDirectoryInBackground(const FString& directoryPath, int32& deleteId)
+{
+    deleteId = DeleteDirectoryAsync(directoryPath);
+    return deleteId != 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+class FRyDeleteDirectoryLatentAction : public FPendingLatentAction
+{
+public:
+    FName ExecutionFunction;
+    int32 OutputLink;
+    FWeakObjectPtr CallbackTarget;
+
+    TSharedPtr<FRyTombstoneDelete, ESPMode::ThreadSafe> DeleteOp;
+    FRyDeleteProgressDelegate OnProgress;
+    FRyDeleteProgress* ProgressOut;
+    bool* SuccessOut;
+
+    FRyDeleteDirectoryLatentAction(const FLatentActionInfo& LatentInfo, TSharedPtr<FRyTombstoneDelete, ESPMode::ThreadSafe> deleteOp, FRyDeleteProgressDelegate onProgress,
+                                   FRyDeleteProgress& progress, bool& success)
+        : ExecutionFunction(LatentInfo.ExecutionFunction)
+        , OutputLink(LatentInfo.Linkage)
+        , CallbackTarget(LatentInfo.CallbackTarget)
+        , DeleteOp(deleteOp)
+        , OnProgress(onProgress)
+        , ProgressOut(&progress)
+        , SuccessOut(&success)
+    {
+    }
+
+    virtual void UpdateOperation(FLatentResponse& Response) override
+    {
+        // No delete means the directory couldn't be renamed, finish straight away
+        const bool done = !DeleteOp.IsValid() || DeleteOp->IsDone();
+        if(DeleteOp.IsValid())
+        {
+            const FRyDeleteProgress progress = DeleteOp->GetProgress();
+            OnProgress.ExecuteIfBound(progress);
+            if(done)
+            {
+                *ProgressOut = progress;
+                *SuccessOut = DeleteOp->HasSucceeded();
+            }
+        }
+        Response.FinishAndTriggerIf(done, ExecutionFunction, OutputLink, CallbackTarget);
+    }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::DeleteDirectoryLatent(UObject* WorldContextObject, const FString& directoryPath, FRyDeleteProgressDelegate OnProgress, FRyDeleteProgress& progress,
+                                                      bool& success, FLatentActionInfo LatentInfo)
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+    {
+        FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+        if (LatentActionManager.FindExistingAction<FRyDeleteDirectoryLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+        {
+            progress = FRyDeleteProgress();
+            success = false;
+            // Holding the delete itself means its result is still there if it finishes before the first update
+            TSharedPtr<FRyTombstoneDelete, ESPMode::ThreadSafe> deleteOp = RyStartDirectoryDelete(directoryPath, nullptr);
+            FRyDeleteDirectoryLatentAction* action = new FRyDeleteDirectoryLatentAction(LatentInfo, deleteOp, OnProgress, progress, success);
+            LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, action);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::GetDirectoryDeleteProgress(const int32 deleteId, FRyDeleteProgress& progress)
+{
+    TSharedPtr<FRyTombstoneDelete, ESPMode::ThreadSafe> deleteOp = FRyTombstoneDeleter::Get().Find(deleteId);
+    if(!deleteOp.IsValid())
+    {
+        progress = FRyDeleteProgress();
+        progress.Done = true;
+        return false;
+    }
+    progress = deleteOp->GetProgress();
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-FText URyRuntimePlatformHelpers::GetFileTimeStampText(const FString& filePath, bool& isValid, const bool longName)
+bool URyRuntimePlatformHelpers::CancelDirectoryDelete(const int32 deleteId)
 {
-    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
-    isValid = FileExists(filePath);
-    if(!isValid)
+    TSharedPtr<FRyTombstoneDelete, ESPMode::ThreadSafe> deleteOp = FRyTombstoneDeleter::Get().Find(deleteId);
+    if(!deleteOp.IsValid())
     {
-        return FText::FromString(TEXT("INVALID"));
+        return false;
     }
-    FDateTime FileTimeStamp = platformFile.GetTimeStamp(*filePath);
-    const FTimespan UTCOffset = FDateTime::Now() - FDateTime::UtcNow();
-    FileTimeStamp += UTCOffset;
-    if(longName)
-    {
-        return FText::AsDateTime(FileTimeStamp, EDateTimeStyle::Long, EDateTimeStyle::Medium, FText::GetInvariantTimeZone());
-    } 
-    return FText::AsDateTime(FileTimeStamp, EDateTimeStyle::Short, EDateTimeStyle::Short,FText::GetInvariantTimeZone());
+    deleteOp->Cancel();
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-bool URyRuntimePlatformHelpers::DeleteFile(const FString& filePath)
+int32 URyRuntimePlatformHelpers::SweepDirectoryTombstones(const TArray<FString>& directories)
 {
     IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
-    return platformFile.DeleteFile(*filePath);
+    FRyTombstoneDeleter& deleter = FRyTombstoneDeleter::Get();
+
+    TArray<FString> tombstones = deleter.TakeRecordedTombstones();
+    for(const FString& directory : directories)
+    {
+        platformFile.IterateDirectory(*directory, [&tombstones](const TCHAR* path, bool isDirectory)
+        {
+            if(isDirectory && FStringView(path).EndsWith(RyTombstone::Extension))
+            {
+                tombstones.AddUnique(path);
+            }
+            return true;
+        });
+    }
+
+    int32 numSwept = 0;
+    for(const FString& tombstone : tombstones)
+    {
+        // Only ever delete directories named as tombstones, never whatever a damaged manifest points at
+        if(tombstone.EndsWith(RyTombstone::Extension) && platformFile.DirectoryExists(*tombstone) && !deleter.IsActive(tombstone))
+        {
+            deleter.Start(tombstone, nullptr);
+            ++numSwept;
+        }
+    }
+    return numSwept;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
-bool URyRuntimePlatformHelpers::DeleteDirectory(const FString& directoryPath, const bool recursive)
+void URyRuntimePlatformHelpers::ShutdownDirectoryDeletes()
 {
-    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
-    if(recursive)
-    {
-        return platformFile.DeleteDirectoryRecursively(*directoryPath);
-    }
-    return platformFile.DeleteDirectory(*directoryPath);
+    FRyTombstoneDeleter::Get().Shutdown();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -289,6 +1929,361 @@ bool URyRuntimePlatformHelpers::MoveFile(const FString& sourcePath, const FStrin
     return fileMoved;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Copies or moves a directory tree. Run does the work on the calling thread plus up to MaxWorkers - 1 pool threads.
+ * Progress counters are atomics so the game thread can read them while the transfer runs.
+*/
+class FRyDirectoryTreeTransfer : public TSharedFromThis<FRyDirectoryTreeTransfer, ESPMode::ThreadSafe>
+{
+public:
+
+    FRyDirectoryTreeTransfer(const FString& sourceDirectory, const FString& destinationDirectory, const bool move, const bool overwrite, const int32 maxWorkers)
+        : SourceRoot(sourceDirectory)
+        , DestinationRoot(destinationDirectory)
+        , Move(move)
+        , Overwrite(overwrite)
+        , MaxWorkers(FMath::Clamp(maxWorkers, 1, 64))
+        , StartTime(FPlatformTime::Seconds())
+        , EndTime(0.0)
+        , Succeeded(false)
+    {
+        FPaths::NormalizeDirectoryName(SourceRoot);
+        FPaths::NormalizeDirectoryName(DestinationRoot);
+    }
+
+    void Run()
+    {
+        Succeeded = DoRun();
+        EndTime = FPlatformTime::Seconds();
+        Done = true;
+    }
+
+    void Cancel() { Canceled = true; }
+    bool IsDone() const { return Done; }
+    bool HasSucceeded() const { return Done && Succeeded; }
+
+    FRyFileTransferProgress GetProgress() const
+    {
+        FRyFileTransferProgress progress;
+        progress.BytesCopied = BytesCopied;
+        progress.TotalBytes = TotalBytes;
+        progress.FilesCopied = FilesCopied;
+        progress.FilesFailed = FilesFailed;
+        progress.TotalFiles = TotalFiles;
+        progress.Seconds = static_cast<float>((Done ? EndTime : FPlatformTime::Seconds()) - StartTime);
+        progress.MegabytesPerSecond = progress.Seconds > 0.0f ? static_cast<float>(progress.BytesCopied / (1024.0 * 1024.0) / progress.Seconds) : 0.0f;
+        return progress;
+    }
+
+private:
+
+    static constexpr int32 CopyBufferSize = 1024 * 1024;
+
+    bool DoRun()
+    {
+        IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+        const FFileStatData sourceStat = platformFile.GetStatData(*SourceRoot);
+        if(!sourceStat.bIsValid || !sourceStat.bIsDirectory)
+        {
+            UE_LOG(LogRyRuntime, Warning, TEXT("FRyDirectoryTreeTransfer: %s is not a directory"), *SourceRoot);
+            return false;
+        }
+
+        // Renaming the whole directory is instant when the destination is free and on the same drive, and needs no scan
+        if(Move && !platformFile.DirectoryExists(*DestinationRoot))
+        {
+            platformFile.CreateDirectoryTree(*FPaths::GetPath(DestinationRoot));
+            if(platformFile.MoveFile(*DestinationRoot, *SourceRoot))
+            {
+                return true;
+            }
+        }
+
+        // One scan of the source gives the sizes and times needed for the whole transfer. A partial scan would leave
+        // files behind, so any directory which can't be listed fails the transfer before anything is touched.
+        TArray<FRyFileInfo> infos;
+        if(!URyRuntimePlatformHelpers::IterateDirectoryStat(SourceRoot, true, ERyIterateDirectoryOut::FilesAndDirectories, infos))
+        {
+            UE_LOG(LogRyRuntime, Warning, TEXT("FRyDirectoryTreeTransfer: Couldn't scan %s"), *SourceRoot);
+            return false;
+        }
+        TArray<FString> dirs;
+        int64 totalBytes = 0;
+        for(const FRyFileInfo& info : infos)
+        {
+            if(info.IsDirectory)
+            {
+                dirs.Add(info.Path.RightChop(SourceRoot.Len() + 1));
+            }
+            else
+            {
+                totalBytes += info.Size;
+                Files.Add(info);
+            }
+        }
+        TotalBytes = totalBytes;
+        TotalFiles = Files.Num();
+
+        if(!platformFile.CreateDirectoryTree(*DestinationRoot))
+        {
+            UE_LOG(LogRyRuntime, Warning, TEXT("FRyDirectoryTreeTransfer: Couldn't create %s"), *DestinationRoot);
+            return false;
+        }
+        for(const FString& dir : dirs)
+        {
+            platformFile.CreateDirectory(*(DestinationRoot / dir));
+        }
+
+        TArray<TFuture<void>> workers;
+        const int32 numWorkers = FMath::Min(MaxWorkers, Files.Num());
+        for(int32 workerIndex = 1; workerIndex < numWorkers; ++workerIndex)
+        {
+            TSharedRef<FRyDirectoryTreeTransfer, ESPMode::ThreadSafe> self = AsShared();
+            workers.Add(Async(EAsyncExecution::ThreadPool, [self]() { self->TransferFiles(); }));
+        }
+        TransferFiles();
+        for(TFuture<void>& worker : workers)
+        {
+            worker.Wait();
+        }
+
+        const bool success = !Canceled && FilesFailed == 0 && FilesCopied == Files.Num();
+        if(success && Move)
+        {
+            // Each moved file is already gone from the source. Only the scanned directories are removed, deepest first,
+            // and DeleteDirectory fails on any which aren't empty so files added after the scan are never deleted.
+            dirs.Sort([](const FString& a, const FString& b) { return a.Len() > b.Len(); });
+            for(const FString& dir : dirs)
+            {
+                platformFile.DeleteDirectory(*(SourceRoot / dir));
+            }
+            platformFile.DeleteDirectory(*SourceRoot);
+        }
+        return success;
+    }
+
+    // Worker loop, each worker takes the next file until none are left
+    void TransferFiles()
+    {
+        IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+        TArray<uint8> buffer;
+        for(int32 fileIndex = NextFile++; fileIndex < Files.Num() && !Canceled; fileIndex = NextFile++)
+        {
+            const FRyFileInfo& info = Files[fileIndex];
+            const FString destinationPath = DestinationRoot / info.Path.RightChop(SourceRoot.Len() + 1);
+            if(!Overwrite && platformFile.FileExists(*destinationPath))
+            {
+                ++FilesFailed;
+                continue;
+            }
+
+            bool transferred = false;
+            if(Move && platformFile.MoveFile(*destinationPath, *info.Path))
+            {
+                BytesCopied += info.Size;
+                transferred = true;
+            }
+            else if(CopyFileBuffered(platformFile, info, destinationPath, buffer))
+            {
+                transferred = !Move || platformFile.DeleteFile(*info.Path);
+            }
+
+            if(transferred)
+            {
+                // The time comes from the scan so keeping it costs one call instead of a GetTimeStamp and SetTimeStamp pair
+                platformFile.SetTimeStamp(*destinationPath, info.ModificationTime);
+                ++FilesCopied;
+            }
+            else
+            {
+                ++FilesFailed;
+            }
+        }
+    }
+
+    bool CopyFileBuffered(IPlatformFile& platformFile, const FRyFileInfo& info, const FString& destinationPath, TArray<uint8>& buffer)
+    {
+        TUniquePtr<IFileHandle> source(platformFile.OpenRead(*info.Path));
+        TUniquePtr<IFileHandle> destination(source ? platformFile.OpenWrite(*destinationPath) : nullptr);
+        if(!source || !destination)
+        {
+            return false;
+        }
+
+        if(buffer.Num() == 0)
+        {
+            buffer.SetNumUninitialized(CopyBufferSize);
+        }
+
+        int64 remaining = source->Size();
+        int64 fileBytesCopied = 0;
+        bool success = true;
+        while(remaining > 0 && success)
+        {
+            if(Canceled)
+            {
+                success = false;
+                break;
+            }
+            const int64 numBytes = FMath::Min<int64>(remaining, buffer.Num());
+            success = source->Read(buffer.GetData(), numBytes) && destination->Write(buffer.GetData(), numBytes);
+            if(success)
+            {
+                remaining -= numBytes;
+                fileBytesCopied += numBytes;
+                BytesCopied += numBytes;
+            }
+        }
+
+        destination.Reset();
+        if(!success)
+        {
+            // The partial copy is deleted so its bytes no longer count towards the progress
+            platformFile.DeleteFile(*destinationPath);
+            BytesCopied -= fileBytesCopied;
+        }
+        return success;
+    }
+
+    FString SourceRoot;
+    FString DestinationRoot;
+    const bool Move;
+    const bool Overwrite;
+    const int32 MaxWorkers;
+    const double StartTime;
+    double EndTime;
+    bool Succeeded;
+
+    TArray<FRyFileInfo> Files;
+    std::atomic<int32> NextFile{0};
+
+    std::atomic<int64> BytesCopied{0};
+    std::atomic<int64> TotalBytes{0};
+    std::atomic<int32> FilesCopied{0};
+    std::atomic<int32> FilesFailed{0};
+    std::atomic<int32> TotalFiles{0};
+    FThreadSafeBool Canceled{false};
+    FThreadSafeBool Done{false};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+class FRyDirectoryTreeTransferLatentAction : public FPendingLatentAction
+{
+public:
+    FName ExecutionFunction;
+    int32 OutputLink;
+    FWeakObjectPtr CallbackTarget;
+
+    TSharedRef<FRyDirectoryTreeTransfer, ESPMode::ThreadSafe> Transfer;
+    FRyFileTransferProgressDelegate OnProgress;
+    FRyFileTransferProgress* ProgressOut;
+    bool* SuccessOut;
+
+    FRyDirectoryTreeTransferLatentAction(const FLatentActionInfo& LatentInfo, TSharedRef<FRyDirectoryTreeTransfer, ESPMode::ThreadSafe> transfer,
+                                         FRyFileTransferProgressDelegate onProgress, FRyFileTransferProgress& progress, bool& success)
+        : ExecutionFunction(LatentInfo.ExecutionFunction)
+        , OutputLink(LatentInfo.Linkage)
+        , CallbackTarget(LatentInfo.CallbackTarget)
+        , Transfer(transfer)
+        , OnProgress(onProgress)
+        , ProgressOut(&progress)
+        , SuccessOut(&success)
+    {
+    }
+
+    virtual ~FRyDirectoryTreeTransferLatentAction()
+    {
+        // Aborted before completing, stop the workers
+        Transfer->Cancel();
+    }
+
+    virtual void UpdateOperation(FLatentResponse& Response) override
+    {
+        const bool done = Transfer->IsDone();
+        const FRyFileTransferProgress progress = Transfer->GetProgress();
+        OnProgress.ExecuteIfBound(progress);
+        if(done)
+        {
+            *ProgressOut = progress;
+            *SuccessOut = Transfer->HasSucceeded();
+        }
+        Response.FinishAndTriggerIf(done, ExecutionFunction, OutputLink, CallbackTarget);
+    }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+static void RyStartDirectoryTreeTransferLatent(UObject* WorldContextObject, const FString& sourceDirectory, const FString& destinationDirectory, const bool move,
+                                               const bool overwrite, const int32 maxWorkers, FRyFileTransferProgressDelegate OnProgress,
+                                               FRyFileTransferProgress& progress, bool& success, FLatentActionInfo LatentInfo)
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+    {
+        FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+        if (LatentActionManager.FindExistingAction<FRyDirectoryTreeTransferLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+        {
+            progress = FRyFileTransferProgress();
+            success = false;
+            TSharedRef<FRyDirectoryTreeTransfer, ESPMode::ThreadSafe> transfer = MakeShared<FRyDirectoryTreeTransfer, ESPMode::ThreadSafe>(
+                sourceDirectory, destinationDirectory, move, overwrite, maxWorkers);
+            // A dedicated thread runs the scan and waits on the pool workers without tying up a pool thread
+            Async(EAsyncExecution::Thread, [transfer]() { transfer->Run(); });
+            FRyDirectoryTreeTransferLatentAction* action = new FRyDirectoryTreeTransferLatentAction(LatentInfo, transfer, OnProgress, progress, success);
+            LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, action);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::CopyDirectoryTreeLatent(UObject* WorldContextObject, const FString& sourceDirectory, const FString& destinationDirectory, const bool overwrite,
+                                                        FRyFileTransferProgressDelegate OnProgress, FRyFileTransferProgress& progress, bool& success, FLatentActionInfo LatentInfo,
+                                                        const int32 maxWorkers)
+{
+    RyStartDirectoryTreeTransferLatent(WorldContextObject, sourceDirectory, destinationDirectory, false, overwrite, maxWorkers, OnProgress, progress, success, LatentInfo);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::MoveDirectoryTreeLatent(UObject* WorldContextObject, const FString& sourceDirectory, const FString& destinationDirectory, const bool overwrite,
+                                                        FRyFileTransferProgressDelegate OnProgress, FRyFileTransferProgress& progress, bool& success, FLatentActionInfo LatentInfo,
+                                                        const int32 maxWorkers)
+{
+    RyStartDirectoryTreeTransferLatent(WorldContextObject, sourceDirectory, destinationDirectory, true, overwrite, maxWorkers, OnProgress, progress, success, LatentInfo);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::CopyDirectoryTree(const FString& sourceDirectory, const FString& destinationDirectory, const bool overwrite, FRyFileTransferProgress& progress,
+                                                  const int32 maxWorkers)
+{
+    TSharedRef<FRyDirectoryTreeTransfer, ESPMode::ThreadSafe> transfer = MakeShared<FRyDirectoryTreeTransfer, ESPMode::ThreadSafe>(
+        sourceDirectory, destinationDirectory, false, overwrite, maxWorkers);
+    transfer->Run();
+    progress = transfer->GetProgress();
+    return transfer->HasSucceeded();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+bool URyRuntimePlatformHelpers::MoveDirectoryTree(const FString& sourceDirectory, const FString& destinationDirectory, const bool overwrite, FRyFileTransferProgress& progress,
+                                                  const int32 maxWorkers)
+{
+    TSharedRef<FRyDirectoryTreeTransfer, ESPMode::ThreadSafe> transfer = MakeShared<FRyDirectoryTreeTransfer, ESPMode::ThreadSafe>(
+        sourceDirectory, destinationDirectory, true, overwrite, maxWorkers);
+    transfer->Run();
+    progress = transfer->GetProgress();
+    return transfer->HasSucceeded();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */
@@ -348,6 +2343,183 @@ void URyRuntimePlatformHelpers::ClipboardPaste(FString& Dest)
     FPlatformApplicationMisc::ClipboardPaste(Dest);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Runs a body over an index range in batches with ParallelFor. Run blocks until every batch ran or the job was canceled.
+ */
+class FRyParallelForJob : public TSharedFromThis<FRyParallelForJob, ESPMode::ThreadSafe>
+{
+public:
+    FRyParallelForJob(const int32 num, const int32 batchSize, RyNativeParallelForBodySig body, const bool blockGarbageCollection)
+        : Num(num)
+        , BatchSize(FMath::Max(batchSize, 1))
+        , Body(MoveTemp(body))
+        , BlockGarbageCollection(blockGarbageCollection)
+    {
+    }
+
+    void Run()
+    {
+        const int32 numBatches = (Num + BatchSize - 1) / BatchSize;
+        ParallelFor(numBatches, [this](const int32 batchIndex)
+        {
+            if(Canceled)
+            {
+                return;
+            }
+
+            // Blueprint bodies touch UObjects, keep GC from running in the middle of a batch
+            TOptional<FGCScopeGuard> gcGuard;
+            if(BlockGarbageCollection)
+            {
+                gcGuard.Emplace();
+            }
+
+            const int32 lastIndex = FMath::Min(Num, (batchIndex + 1) * BatchSize);
+            for(int32 index = batchIndex * BatchSize; index < lastIndex; ++index)
+            {
+                Body(index);
+            }
+        });
+        Done = true;
+    }
+
+    void Cancel() { Canceled = true; }
+    bool IsDone() const { return Done; }
+
+private:
+    const int32 Num;
+    const int32 BatchSize;
+    RyNativeParallelForBodySig Body;
+    const bool BlockGarbageCollection;
+    std::atomic<bool> Canceled{false};
+    std::atomic<bool> Done{false};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Waits on a FRyParallelForJob, or runs the body itself on the game thread batchSize indices per update when no job
+ * was started because the bound function isn't pure.
+ */
+class FRyParallelForLatentAction : public FPendingLatentAction
+{
+public:
+    FName ExecutionFunction;
+    int32 OutputLink;
+    FWeakObjectPtr CallbackTarget;
+
+    TSharedPtr<FRyParallelForJob, ESPMode::ThreadSafe> Job;
+    FRyParallelForBody Body;
+    TSharedRef<TArray<float>, ESPMode::ThreadSafe> Results;
+    TArray<float>* ResultsOut;
+    const int32 BatchSize;
+    int32 NextIndex;
+
+    FRyParallelForLatentAction(const FLatentActionInfo& LatentInfo, TSharedPtr<FRyParallelForJob, ESPMode::ThreadSafe> job, FRyParallelForBody body,
+                               TSharedRef<TArray<float>, ESPMode::ThreadSafe> results, TArray<float>& resultsOut, const int32 batchSize)
+        : ExecutionFunction(LatentInfo.ExecutionFunction)
+        , OutputLink(LatentInfo.Linkage)
+        , CallbackTarget(LatentInfo.CallbackTarget)
+        , Job(job)
+        , Body(body)
+        , Results(results)
+        , ResultsOut(&resultsOut)
+        , BatchSize(FMath::Max(batchSize, 1))
+        , NextIndex(0)
+    {
+    }
+
+    virtual ~FRyParallelForLatentAction()
+    {
+        // Aborted before completing, skip the batches which haven't started
+        if(Job.IsValid())
+        {
+            Job->Cancel();
+        }
+    }
+
+    virtual void UpdateOperation(FLatentResponse& Response) override
+    {
+        bool done;
+        if(Job.IsValid())
+        {
+            done = Job->IsDone();
+        }
+        else
+        {
+            const int32 lastIndex = FMath::Min(Results->Num(), NextIndex + BatchSize);
+            for(; NextIndex < lastIndex; ++NextIndex)
+            {
+                (*Results)[NextIndex] = Body.IsBound() ? Body.Execute(NextIndex) : 0.0f;
+            }
+            done = NextIndex >= Results->Num();
+        }
+
+        if(done)
+        {
+            *ResultsOut = MoveTemp(*Results);
+        }
+        Response.FinishAndTriggerIf(done, ExecutionFunction, OutputLink, CallbackTarget);
+    }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::ParallelForLatent(UObject* WorldContextObject, const int32 num, FRyParallelForBody Body, TArray<float>& results, FLatentActionInfo LatentInfo,
+                                                  const int32 batchSize, const bool runOnWorkerThreads)
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+    {
+        FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+        if (LatentActionManager.FindExistingAction<FRyParallelForLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+        {
+            TSharedRef<TArray<float>, ESPMode::ThreadSafe> gathered = MakeShared<TArray<float>, ESPMode::ThreadSafe>();
+            gathered->SetNumZeroed(FMath::Max(num, 0));
+
+            // Off the game thread only when the caller opted in and the function is pure and const. Pure alone still
+            // allows setting member variables and calling impure nodes, which aren't thread safe.
+            const UObject* bodyObject = Body.GetUObject();
+            const UFunction* bodyFunction = bodyObject ? bodyObject->FindFunction(Body.GetFunctionName()) : nullptr;
+            TSharedPtr<FRyParallelForJob, ESPMode::ThreadSafe> job;
+            if(runOnWorkerThreads && bodyFunction && bodyFunction->HasAllFunctionFlags(FUNC_BlueprintPure | FUNC_Const) && num > 0)
+            {
+                job = MakeShared<FRyParallelForJob, ESPMode::ThreadSafe>(num, batchSize, [Body, gathered](const int32 index)
+                {
+                    (*gathered)[index] = Body.IsBound() ? Body.Execute(index) : 0.0f;
+                }, true);
+                Async(EAsyncExecution::TaskGraph, [job]() { job->Run(); });
+            }
+            else if(runOnWorkerThreads && bodyFunction && num > 0)
+            {
+                UE_LOG(LogRyRuntime, Warning, TEXT("ParallelForLatent: %s isn't both pure and const, running it on the game thread"), *bodyFunction->GetName());
+            }
+
+            FRyParallelForLatentAction* action = new FRyParallelForLatentAction(LatentInfo, job, Body, gathered, results, batchSize);
+            LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, action);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+*/
+void URyRuntimePlatformHelpers::ParallelForAsync(const int32 num, RyNativeParallelForBodySig body, RyNativeParallelForCompleteSig onComplete, const int32 batchSize)
+{
+    TSharedRef<FRyParallelForJob, ESPMode::ThreadSafe> job = MakeShared<FRyParallelForJob, ESPMode::ThreadSafe>(FMath::Max(num, 0), batchSize, MoveTemp(body), false);
+    Async(EAsyncExecution::TaskGraph, [job, onComplete = MoveTemp(onComplete)]()
+    {
+        job->Run();
+        if(onComplete)
+        {
+            AsyncTask(ENamedThreads::GameThread, [onComplete]()
+            {
+                onComplete();
+            });
+        }
+    });
+}
+
 #if ENGINE_MAJOR_VERSION > 4 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 27)
 static_assert(ERyDeviceScreenOrientation::LandscapeSensor == static_cast<ERyDeviceScreenOrientation>(EDeviceScreenOrientation::LandscapeSensor), "EDeviceScreenOrientation misalignment!");
 #else
@@ -0,0 +1,63 @@
+// Copyright 2020-2023 Solar Storm Interactive
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "RyRuntimePlatformHelpers.h"
+
+struct FFileStatData;
+
+/**
+ * A FRyFileFilterSpec parsed into a form which can be matched against many paths cheaply.
+ * Compile once and reuse it for every path of a scan, see URyRuntimePlatformHelpers::IterateDirectoryCompiledFilter.
+ */
+class RYRUNTIME_API FRyCompiledFileFilter
+{
+public:
+
+	explicit FRyCompiledFileFilter(const FRyFileFilterSpec& spec);
+
+	/**
+	 * True if a file passes the filter
+	 * @param relativePath The path of the file relative to the scanned directory
+	 * @param name The file name with extension
+	 * @param statData The file's stat data for the size and date limits
+	 */
+	bool MatchesFile(const FStringView relativePath, const FStringView name, const FFileStatData& statData) const;
+
+	/**
+	 * True if a directory and everything inside it should be skipped
+	 * @param relativePath The path of the directory relative to the scanned directory
+	 * @param name The directory name
+	 */
+	bool IsDirectoryExcluded(const FStringView relativePath, const FStringView name) const;
+
+	/** Match text against a glob where * matches any run of characters and ? matches one character */
+	static bool MatchGlob(const FStringView pattern, const FStringView text, const bool caseSensitive);
+
+private:
+
+	struct FPattern
+	{
+		FString Glob;
+		// Match against the relative path instead of the name
+		bool MatchPath = false;
+	};
+
+	static void CompilePatterns(const TArray<FString>& patterns, TArray<FPattern>& compiledOut);
+	bool MatchesAny(const TArray<FPattern>& patterns, const FStringView relativePath, const FStringView name) const;
+
+	TArray<FPattern> IncludePatterns;
+	TArray<FPattern> ExcludePatterns;
+	TArray<FPattern> ExcludeDirectories;
+
+	// Without the leading dot
+	TArray<FString> Extensions;
+
+	int64 MinSize;
+	int64 MaxSize;
+	int64 ModifiedAfterTicks;
+	int64 ModifiedBeforeTicks;
+	bool CaseSensitive;
+};
@@ -0,0 +1,93 @@
+// Copyright 2020-2023 Solar Storm Interactive
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+
+class IFileHandle;
+
+/**
+ * Reads a UTF-8 or ANSI text file one line at a time through a small reusable buffer, so huge files can be processed
+ * without loading them into one FString. Line endings (\n or \r\n) are stripped and a UTF-8 BOM is skipped.
+ * NOTE: UTF-16 files are not supported, use URyRuntimeFileHelpers::LoadFileToString for those.
+ *
+ * Native range-for over the lines, each view is only valid until the next line is read:
+ *     FRyFileLineReader reader(path);
+ *     for(const FStringView line : reader) { ... }
+ */
+class RYRUNTIME_API FRyFileLineReader
+{
+public:
+
+	/**
+	 * @param filePath The full path to the file to read
+	 * @param bufferSize The initial size of the read buffer. Grows if a single line is longer than this.
+	 */
+	explicit FRyFileLineReader(const FString& filePath, const int32 bufferSize = 64 * 1024);
+	~FRyFileLineReader();
+
+	FRyFileLineReader(const FRyFileLineReader&) = delete;
+	FRyFileLineReader& operator=(const FRyFileLineReader&) = delete;
+
+	/** True if the file was opened and no read has failed */
+	bool IsValid() const { return FileHandle != nullptr && !Failed; }
+
+	/**
+	 * Read the next line as raw UTF-8 bytes without converting it. The view is valid until the next read.
+	 * @return False at the end of the file or if a read failed
+	 */
+	bool ReadLineUtf8(TArrayView<const uint8>& lineOut);
+
+	/**
+	 * Read the next line converted to TCHAR. The view is valid until the next read.
+	 * @return False at the end of the file or if a read failed
+	 */
+	bool ReadLine(FStringView& lineOut);
+
+	/** The 1 based number of the line last read, 0 if no line has been read */
+	int64 GetLineNumber() const { return LineNumber; }
+
+	/** Range-for support, iterating reads lines from the file */
+	class FIterator
+	{
+	public:
+		explicit FIterator(FRyFileLineReader* reader) : Reader(reader) { Advance(); }
+		FStringView operator*() const { return Line; }
+		FIterator& operator++() { Advance(); return *this; }
+		bool operator!=(const FIterator& other) const { return Reader != other.Reader; }
+
+	private:
+		void Advance()
+		{
+			if(Reader && !Reader->ReadLine(Line))
+			{
+				Reader = nullptr;
+			}
+		}
+
+		FRyFileLineReader* Reader;
+		FStringView Line;
+	};
+
+	FIterator begin() { return FIterator(this); }
+	FIterator end() { return FIterator(nullptr); }
+
+private:
+
+	/** Move unread bytes to the front of the buffer and fill the rest from the file. False if nothing more could be read. */
+	bool FillBuffer();
+
+	IFileHandle* FileHandle;
+	int64 FileSize;
+	int64 FileOffset;
+	int64 LineNumber;
+	bool Failed;
+
+	TArray<uint8> Buffer;
+	int32 BufferStart;
+	int32 BufferEnd;
+
+	// Reused storage for the TCHAR version of the current line
+	TArray<TCHAR> LineChars;
+};
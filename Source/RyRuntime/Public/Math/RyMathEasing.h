@@ -47,6 +47,7 @@ enum class ERyMathEasingType : uint8
  * Math Library for common easing functions.
  * Uses AHEasing internally. Copyright (c) 2011, Auerhaus Development, LLC
  * Under the Do What The Fuck You Want To Public License, Version 2
+ * NOTE: Native code with a known easing type should use RyEase<> in Math/RyMathEasingInline.h to skip the runtime dispatch.
  */
 UCLASS(meta=(BlueprintThreadSafe))
 class RYRUNTIME_API URyMathEasing : public UBlueprintFunctionLibrary
@@ -83,4 +84,17 @@ public:
 	*/
 	UFUNCTION(BlueprintPure, Category = "RyRuntime|Math|Easing")
 	static FRotator EaseRotator(const ERyMathEasingType easing, const FRotator& start, const FRotator& target, const float alpha = 0.0f);
+
+	/**
+	* Ease a rotator from start to target using a quaternion slerp along the shortest arc.
+	* Prefer this over EaseRotator when more than one axis is changing.
+	* NOTE: Native code with a known easing type can use RyEaseQuat in Math/RyMathEasingInline.h
+	* @param easing - The easing to use
+	* @param start - The starting rotator
+	* @param target - The target rotator
+	* @param alpha - The alpha, clamped 0-1
+	* @return The rotator eased from start to target depending on the alpha
+	*/
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|Math|Easing")
+	static FRotator EaseRotatorSlerp(const ERyMathEasingType easing, const FRotator& start, const FRotator& target, const float alpha = 0.0f);
 };
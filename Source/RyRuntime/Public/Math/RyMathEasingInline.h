@@ -0,0 +1,336 @@
+// Copyright 2020-2023 Solar Storm Interactive
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RyMathEasing.h"
+
+/**
+ * Compile time easing for native callers.
+ * URyMathEasing::EaseFloat picks the easing function at runtime with a switch. When the easing is known at compile time
+ * use RyEase<ERyMathEasingType::CubicEaseInOut>(alpha) instead, which inlines the easing math directly at the call site.
+ * The polynomial and bounce easings are constexpr, the others rely on sin, sqrt or pow and are only inline.
+ * The math mirrors AHEasing (ThirdParty/AHEasing) so results match URyMathEasing::EaseFloat.
+ */
+namespace RyEasing
+{
+	constexpr float HalfPi = 1.57079632679f;
+	constexpr float Pi = 3.1415926535897932f;
+
+	/** Clamp alpha to 0-1, the same as URyMathEasing::EaseFloat does */
+	FORCEINLINE constexpr float ClampAlpha(const float alpha)
+	{
+		return alpha < 0.0f ? 0.0f : (alpha > 1.0f ? 1.0f : alpha);
+	}
+
+	/** Specialized per easing type below. Apply expects p to already be clamped 0-1. */
+	template<ERyMathEasingType Easing>
+	struct TEase;
+
+	template<> struct TEase<ERyMathEasingType::Linear>
+	{
+		static FORCEINLINE constexpr float Apply(const float p) { return p; }
+	};
+
+	template<> struct TEase<ERyMathEasingType::QuadraticEaseIn>
+	{
+		static FORCEINLINE constexpr float Apply(const float p) { return p * p; }
+	};
+
+	template<> struct TEase<ERyMathEasingType::QuadraticEaseOut>
+	{
+		static FORCEINLINE constexpr float Apply(const float p) { return -(p * (p - 2.f)); }
+	};
+
+	template<> struct TEase<ERyMathEasingType::QuadraticEaseInOut>
+	{
+		static FORCEINLINE constexpr float Apply(const float p)
+		{
+			return p < 0.5f ? 2.f * p * p : (-2.f * p * p) + (4.f * p) - 1.f;
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::CubicEaseIn>
+	{
+		static FORCEINLINE constexpr float Apply(const float p) { return p * p * p; }
+	};
+
+	template<> struct TEase<ERyMathEasingType::CubicEaseOut>
+	{
+		static FORCEINLINE constexpr float Apply(const float p)
+		{
+			const float f = p - 1.f;
+			return f * f * f + 1.f;
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::CubicEaseInOut>
+	{
+		static FORCEINLINE constexpr float Apply(const float p)
+		{
+			if(p < 0.5f)
+			{
+				return 4.f * p * p * p;
+			}
+			const float f = (2.f * p) - 2.f;
+			return 0.5f * f * f * f + 1.f;
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::QuarticEaseIn>
+	{
+		static FORCEINLINE constexpr float Apply(const float p) { return p * p * p * p; }
+	};
+
+	template<> struct TEase<ERyMathEasingType::QuarticEaseOut>
+	{
+		static FORCEINLINE constexpr float Apply(const float p)
+		{
+			const float f = p - 1.f;
+			return f * f * f * (1.f - p) + 1.f;
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::QuarticEaseInOut>
+	{
+		static FORCEINLINE constexpr float Apply(const float p)
+		{
+			if(p < 0.5f)
+			{
+				return 8.f * p * p * p * p;
+			}
+			const float f = p - 1.f;
+			return -8.f * f * f * f * f + 1.f;
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::QuinticEaseIn>
+	{
+		static FORCEINLINE constexpr float Apply(const float p) { return p * p * p * p * p; }
+	};
+
+	template<> struct TEase<ERyMathEasingType::QuinticEaseOut>
+	{
+		static FORCEINLINE constexpr float Apply(const float p)
+		{
+			const float f = p - 1.f;
+			return f * f * f * f * f + 1.f;
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::QuinticEaseInOut>
+	{
+		static FORCEINLINE constexpr float Apply(const float p)
+		{
+			if(p < 0.5f)
+			{
+				return 16.f * p * p * p * p * p;
+			}
+			const float f = (2.f * p) - 2.f;
+			return 0.5f * f * f * f * f * f + 1.f;
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::SineEaseIn>
+	{
+		static FORCEINLINE float Apply(const float p) { return FMath::Sin((p - 1.f) * HalfPi) + 1.f; }
+	};
+
+	template<> struct TEase<ERyMathEasingType::SineEaseOut>
+	{
+		static FORCEINLINE float Apply(const float p) { return FMath::Sin(p * HalfPi); }
+	};
+
+	template<> struct TEase<ERyMathEasingType::SineEaseInOut>
+	{
+		static FORCEINLINE float Apply(const float p) { return 0.5f * (1.f - FMath::Cos(p * Pi)); }
+	};
+
+	template<> struct TEase<ERyMathEasingType::CircularEaseIn>
+	{
+		static FORCEINLINE float Apply(const float p) { return 1.f - FMath::Sqrt(1.f - (p * p)); }
+	};
+
+	template<> struct TEase<ERyMathEasingType::CircularEaseOut>
+	{
+		static FORCEINLINE float Apply(const float p) { return FMath::Sqrt((2.f - p) * p); }
+	};
+
+	template<> struct TEase<ERyMathEasingType::CircularEaseInOut>
+	{
+		static FORCEINLINE float Apply(const float p)
+		{
+			if(p < 0.5f)
+			{
+				return 0.5f * (1.f - FMath::Sqrt(1.f - 4.f * (p * p)));
+			}
+			return 0.5f * (FMath::Sqrt(-((2.f * p) - 3.f) * ((2.f * p) - 1.f)) + 1.f);
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::ExponentialEaseIn>
+	{
+		static FORCEINLINE float Apply(const float p) { return (p == 0.f) ? p : FMath::Pow(2.f, 10.f * (p - 1.f)); }
+	};
+
+	template<> struct TEase<ERyMathEasingType::ExponentialEaseOut>
+	{
+		static FORCEINLINE float Apply(const float p) { return (p == 1.f) ? p : 1.f - FMath::Pow(2.f, -10.f * p); }
+	};
+
+	template<> struct TEase<ERyMathEasingType::ExponentialEaseInOut>
+	{
+		static FORCEINLINE float Apply(const float p)
+		{
+			if(p == 0.f || p == 1.f)
+			{
+				return p;
+			}
+			if(p < 0.5f)
+			{
+				return 0.5f * FMath::Pow(2.f, (20.f * p) - 10.f);
+			}
+			return -0.5f * FMath::Pow(2.f, (-20.f * p) + 10.f) + 1.f;
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::ElasticEaseIn>
+	{
+		static FORCEINLINE float Apply(const float p) { return FMath::Sin(13.f * HalfPi * p) * FMath::Pow(2.f, 10.f * (p - 1.f)); }
+	};
+
+	template<> struct TEase<ERyMathEasingType::ElasticEaseOut>
+	{
+		static FORCEINLINE float Apply(const float p) { return FMath::Sin(-13.f * HalfPi * (p + 1.f)) * FMath::Pow(2.f, -10.f * p) + 1.f; }
+	};
+
+	template<> struct TEase<ERyMathEasingType::ElasticEaseInOut>
+	{
+		static FORCEINLINE float Apply(const float p)
+		{
+			if(p < 0.5f)
+			{
+				return 0.5f * FMath::Sin(13.f * HalfPi * (2.f * p)) * FMath::Pow(2.f, 10.f * ((2.f * p) - 1.f));
+			}
+			return 0.5f * (FMath::Sin(-13.f * HalfPi * ((2.f * p - 1.f) + 1.f)) * FMath::Pow(2.f, -10.f * (2.f * p - 1.f)) + 2.f);
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::BackEaseIn>
+	{
+		static FORCEINLINE float Apply(const float p) { return p * p * p - p * FMath::Sin(p * Pi); }
+	};
+
+	template<> struct TEase<ERyMathEasingType::BackEaseOut>
+	{
+		static FORCEINLINE float Apply(const float p)
+		{
+			const float f = 1.f - p;
+			return 1.f - (f * f * f - f * FMath::Sin(f * Pi));
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::BackEaseInOut>
+	{
+		static FORCEINLINE float Apply(const float p)
+		{
+			if(p < 0.5f)
+			{
+				const float f = 2.f * p;
+				return 0.5f * (f * f * f - f * FMath::Sin(f * Pi));
+			}
+			const float f = 1.f - (2.f * p - 1.f);
+			return 0.5f * (1.f - (f * f * f - f * FMath::Sin(f * Pi))) + 0.5f;
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::BounceEaseOut>
+	{
+		static FORCEINLINE constexpr float Apply(const float p)
+		{
+			if(p < 4.f / 11.f)
+			{
+				return (12.f * p * p) / 16.f;
+			}
+			if(p < 8.f / 11.f)
+			{
+				return (363.f / 40.f * p * p) - (99.f / 10.f * p) + 17.f / 5.f;
+			}
+			if(p < 9.f / 10.f)
+			{
+				return (4356.f / 361.f * p * p) - (35442.f / 1805.f * p) + 16061.f / 1805.f;
+			}
+			return (54.f / 5.f * p * p) - (513.f / 25.f * p) + 268.f / 25.f;
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::BounceEaseIn>
+	{
+		static FORCEINLINE constexpr float Apply(const float p)
+		{
+			return 1.f - TEase<ERyMathEasingType::BounceEaseOut>::Apply(1.f - p);
+		}
+	};
+
+	template<> struct TEase<ERyMathEasingType::BounceEaseInOut>
+	{
+		static FORCEINLINE constexpr float Apply(const float p)
+		{
+			if(p < 0.5f)
+			{
+				return 0.5f * TEase<ERyMathEasingType::BounceEaseIn>::Apply(p * 2.f);
+			}
+			return 0.5f * TEase<ERyMathEasingType::BounceEaseOut>::Apply(p * 2.f - 1.f) + 0.5f;
+		}
+	};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Determine the easing value of alpha with the easing known at compile time.
+ * Same output as URyMathEasing::EaseFloat(Easing, alpha). constexpr for the polynomial and bounce easings.
+ * @param alpha - The alpha, clamped 0-1
+ */
+template<ERyMathEasingType Easing>
+FORCEINLINE constexpr float RyEase(const float alpha)
+{
+	return RyEasing::TEase<Easing>::Apply(RyEasing::ClampAlpha(alpha));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Ease a vector from start to target with the easing known at compile time.
+ * Same output as URyMathEasing::EaseVector.
+ */
+template<ERyMathEasingType Easing>
+FORCEINLINE FVector RyEaseVector(const FVector& start, const FVector& target, const float alpha)
+{
+	if(alpha == 0.0f)
+	{
+		return start;
+	}
+	if(alpha == 1.0f)
+	{
+		return target;
+	}
+	return start + RyEase<Easing>(alpha) * (target - start);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Ease a rotation from start to target along the shortest arc using a quaternion slerp.
+ * Unlike URyMathEasing::EaseRotator this does not suffer from gimbal issues when more than one axis changes.
+ */
+template<ERyMathEasingType Easing>
+FORCEINLINE FQuat RyEaseQuat(const FQuat& start, const FQuat& target, const float alpha)
+{
+	if(alpha == 0.0f)
+	{
+		return start;
+	}
+	if(alpha == 1.0f)
+	{
+		return target;
+	}
+	return FQuat::Slerp(start, target, RyEase<Easing>(alpha));
+}
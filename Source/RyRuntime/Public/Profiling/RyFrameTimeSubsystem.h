@@ -0,0 +1,191 @@
+// Copyright 2020-2023 Solar Storm Interactive
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "RyFrameTimeSubsystem.generated.h"
+
+/**
+ * Fixed memory histogram of microsecond values with HDR style log-linear buckets.
+ * Values below 64us are exact, above that each power of two is split into 32 buckets, so any value is within about 3%.
+ * Values are clamped to about 67 seconds.
+ */
+class RYRUNTIME_API FRyLogHistogram
+{
+public:
+
+	static constexpr uint32 SubBucketBits = 5;
+	static constexpr uint32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr uint32 MaxExponent = 26;
+	static constexpr int32 NumBuckets = (MaxExponent - SubBucketBits) * SubBucketCount + 2 * SubBucketCount;
+
+	FRyLogHistogram() { Reset(); }
+
+	void Add(const uint32 valueUs) { ++Counts[GetBucketIndex(valueUs)]; ++TotalCount; TotalUs += valueUs; }
+	void Remove(const uint32 valueUs) { --Counts[GetBucketIndex(valueUs)]; --TotalCount; TotalUs -= valueUs; }
+	void Reset();
+
+	uint64 GetCount() const { return TotalCount; }
+	double GetAverageUs() const { return TotalCount > 0 ? static_cast<double>(TotalUs) / TotalCount : 0.0; }
+
+	/** The value at percentile (0-100), the middle of the bucket holding it */
+	double GetPercentileUs(const float percentile) const;
+
+	/** The middle of the highest non empty bucket */
+	double GetMaxUs() const;
+
+	uint32 GetBucketCount(const int32 bucketIndex) const { return Counts[bucketIndex]; }
+	static int32 GetBucketIndex(uint32 valueUs);
+	static uint32 GetBucketLowerUs(const int32 bucketIndex);
+	static uint32 GetBucketWidthUs(const int32 bucketIndex);
+
+private:
+
+	uint32 Counts[NumBuckets];
+	uint64 TotalCount;
+	uint64 TotalUs;
+};
+
+/** The times recorded per frame by URyFrameTimeSubsystem */
+UENUM(BlueprintType)
+enum class ERyFrameTimeMetric : uint8
+{
+	/** The whole frame, the application delta time */
+	Frame,
+	/** Time the game thread spent working, excluding idle time waiting to hit a fixed frame rate */
+	GameThread,
+	/** Time the render thread spent working. Only recorded when enabled with SetRecordRenderThread. */
+	RenderThread,
+};
+
+/** Summary of one metric over a range of frames, times are in milliseconds */
+USTRUCT(BlueprintType)
+struct FRyFrameTimeStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "FrameTimeStats")
+	int32 NumFrames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "FrameTimeStats")
+	float Average = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "FrameTimeStats")
+	float P50 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "FrameTimeStats")
+	float P95 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "FrameTimeStats")
+	float P99 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "FrameTimeStats")
+	float Max = 0.0f;
+
+	/** Frames at or over the hitch threshold */
+	UPROPERTY(BlueprintReadOnly, Category = "FrameTimeStats")
+	int32 NumHitches = 0;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FRyFrameHitchDelegate, float, FrameTimeMs, float, GameThreadMs, float, RenderThreadMs);
+
+/**
+ * Records frame, game thread and optionally render thread times every frame into fixed memory histograms, both for
+ * the whole run and for a rolling window of recent frames. Works on dedicated servers, useful for automated perf gates.
+ * Dump the histograms with DumpCsv, the Ry.FrameTimes.DumpCsv console command, or at shutdown by passing
+ * -RyFrameTimesCsv or -RyFrameTimesCsv=<path> on the command line.
+ */
+UCLASS()
+class RYRUNTIME_API URyFrameTimeSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Get the subsystem, null if the engine isn't running */
+	static URyFrameTimeSubsystem* Get();
+
+	/**
+	 * Get a percentile of a frame time metric in milliseconds
+	 * @param metric The time to query
+	 * @param percentile 0-100, ie 99 for p99
+	 * @param rollingWindow If true only the recent frames in the rolling window count, otherwise every frame since the last Reset
+	 */
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|FrameTimes")
+	float GetFrameTimePercentile(const ERyFrameTimeMetric metric, const float percentile, const bool rollingWindow = true) const;
+
+	/** Get the average, p50, p95, p99, max and hitch count of a frame time metric */
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|FrameTimes")
+	FRyFrameTimeStats GetFrameTimeStats(const ERyFrameTimeMetric metric, const bool rollingWindow = true) const;
+
+	/** Set how many recent frames the rolling window covers. Clears the rolling window. */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FrameTimes")
+	void SetRollingWindowFrames(const int32 numFrames);
+
+	/** Frames taking this many milliseconds or more count as hitches and broadcast OnHitch */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FrameTimes")
+	void SetHitchThreshold(const float milliseconds);
+
+	/** Enable recording the render thread time, off by default */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FrameTimes")
+	void SetRecordRenderThread(const bool record);
+
+	/** Clear every recorded frame */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FrameTimes")
+	void Reset();
+
+	/**
+	 * Write the stats and histograms of every metric to a CSV file
+	 * @param filePath The file to write, if empty a time stamped file in Saved/Profiling is used
+	 * @return True if the file was written
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FrameTimes")
+	bool DumpCsv(const FString& filePath);
+
+	/** Dump the CSV when the subsystem shuts down */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FrameTimes")
+	void SetDumpCsvOnShutdown(const bool dump, const FString& filePath);
+
+	/** Broadcast on the game thread after a frame which took at least the hitch threshold */
+	UPROPERTY(BlueprintAssignable, Category = "RyRuntime|FrameTimes")
+	FRyFrameHitchDelegate OnHitch;
+
+private:
+
+	static constexpr int32 NumMetrics = 3;
+
+	struct FFrameSample
+	{
+		uint32 TimesUs[NumMetrics];
+		bool IsHitch;
+	};
+
+	bool Tick(float DeltaTime);
+	void RecordFrame(const FFrameSample& sample);
+
+	FRyLogHistogram TotalHistograms[NumMetrics];
+	FRyLogHistogram RollingHistograms[NumMetrics];
+	int32 TotalHitches = 0;
+	int32 RollingHitches = 0;
+
+	// Ring of the frames in the rolling window so they can be removed from the rolling histograms as they age out
+	TArray<FFrameSample> RollingFrames;
+	int32 RollingWindowFrames = 600;
+	int32 RollingNext = 0;
+
+	uint32 HitchThresholdUs = 100000;
+	bool RecordRenderThread = false;
+	bool DumpOnShutdown = false;
+	FString ShutdownCsvPath;
+
+#if ENGINE_MAJOR_VERSION > 4
+	FTSTicker::FDelegateHandle TickHandle;
+#else
+	FDelegateHandle TickHandle;
+#endif
+};
@@ -0,0 +1,144 @@
+// Copyright 2020-2023 Solar Storm Interactive
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "RyResourceSamplerSubsystem.generated.h"
+
+/** The values recorded in each sample by URyResourceSamplerSubsystem */
+UENUM(BlueprintType)
+enum class ERyResourceMetric : uint8
+{
+	/** Physical memory used by the process */
+	UsedPhysical,
+	/** Highest physical memory used by the process so far */
+	PeakUsedPhysical,
+	/** Virtual memory used by the process */
+	UsedVirtual,
+	/** Highest virtual memory used by the process so far */
+	PeakUsedVirtual,
+	/** Physical memory still available on the machine */
+	AvailablePhysical,
+	/** CPU used by the process as a percentage of every core */
+	ProcessCpu,
+	/** Free space on the disk holding the sampled path */
+	DiskFree,
+};
+
+/** One resource sample. Memory and disk values are in bytes. */
+USTRUCT(BlueprintType)
+struct FRyResourceSample
+{
+	GENERATED_BODY()
+
+	/** Seconds since the sampler started */
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceSample")
+	float Seconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceSample")
+	int64 UsedPhysical = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceSample")
+	int64 PeakUsedPhysical = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceSample")
+	int64 UsedVirtual = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceSample")
+	int64 PeakUsedVirtual = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceSample")
+	int64 AvailablePhysical = 0;
+
+	/** 0-100 of every core */
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceSample")
+	float ProcessCpu = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceSample")
+	int64 DiskFree = 0;
+};
+
+/** Summary of one metric over a window of samples. Memory and disk values are in megabytes, CPU is in percent. */
+USTRUCT(BlueprintType)
+struct FRyResourceStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceStats")
+	int32 NumSamples = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceStats")
+	float Min = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceStats")
+	float Average = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceStats")
+	float Max = 0.0f;
+
+	/** The newest sample in the window */
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceStats")
+	float Latest = 0.0f;
+
+	/** Least squares slope of the samples, ie megabytes per hour of growth. Useful to spot leaks in soak tests. */
+	UPROPERTY(BlueprintReadOnly, Category = "ResourceStats")
+	float ChangePerHour = 0.0f;
+};
+
+/**
+ * Samples process memory, process CPU and free disk space on a background thread at a fixed interval.
+ * Samples go into a fixed size lock-free ring buffer, so reading stats from the game thread never blocks the sampler.
+ * Not running by default, start it with StartSampling or pass -RyResourceSampler or -RyResourceSampler=<seconds> on
+ * the command line, ie for soak tests on dedicated servers.
+ */
+UCLASS()
+class RYRUNTIME_API URyResourceSamplerSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Get the subsystem, null if the engine isn't running */
+	static URyResourceSamplerSubsystem* Get();
+
+	/**
+	 * Start sampling, restarting with the new settings if already running. Clears the previous samples.
+	 * @param intervalSeconds Time between samples
+	 * @param maxSamples How many samples are kept, the oldest are overwritten. 8192 at 1 second is a little over 2 hours.
+	 * @param diskPath The path whose disk free space is sampled, if empty the project Saved directory is used
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|ResourceSampler")
+	void StartSampling(const float intervalSeconds = 1.0f, const int32 maxSamples = 8192, const FString& diskPath = TEXT(""));
+
+	/** Stop the sampling thread. The samples taken so far can still be queried. */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|ResourceSampler")
+	void StopSampling();
+
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|ResourceSampler")
+	bool IsSampling() const;
+
+	/** Get the newest sample, false if nothing has been sampled yet */
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|ResourceSampler")
+	bool GetLatestResourceSample(FRyResourceSample& sampleOut) const;
+
+	/**
+	 * Get the samples taken in the last windowSeconds, oldest first
+	 * @param windowSeconds How far back to look, 0 or less for every sample still in the ring buffer
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|ResourceSampler")
+	void GetResourceSamples(TArray<FRyResourceSample>& samplesOut, const float windowSeconds = 0.0f) const;
+
+	/**
+	 * Get the min, average, max and trend of a metric over the samples taken in the last windowSeconds
+	 * @param windowSeconds How far back to look, 0 or less for every sample still in the ring buffer
+	 */
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|ResourceSampler")
+	FRyResourceStats GetResourceStats(const ERyResourceMetric metric, const float windowSeconds = 60.0f) const;
+
+private:
+
+	class FRyResourceSampler* Sampler = nullptr;
+};
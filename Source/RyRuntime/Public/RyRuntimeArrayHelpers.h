@@ -8,7 +8,11 @@
 
 #include "RyRuntimeArrayHelpers.generated.h"
 
-//DECLARE_DYNAMIC_DELEGATE_RetVal_TwoParams(bool, FRyGenericArraySort, const int32&, A, const int32&, B);
+/**
+ * Return true if the element at index A should be sorted before the element at index B.
+ * The indices are into the array as it was before sorting, the array isn't changed until the sort is done.
+ */
+DECLARE_DYNAMIC_DELEGATE_RetVal_TwoParams(bool, FRyGenericArraySort, const int32, A, const int32, B);
 
 /**
  * Helpers for generic arrays
@@ -137,10 +141,20 @@ public:
 		P_NATIVE_END;
 	}
 
-	/*UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Sort", CompactNodeTitle = "SORT", ArrayParm = "TargetArray", ArrayTypeDependentParams = "SortFunc", Keywords = "sort"), Category="RyRuntime|Array")
-	static void Array_Sort(const TArray<int32>& TargetArray, FRyGenericArraySort SortFunc);
+	/* 
+	 * Sort the array in place.
+	 * Integer, float, enum and bool arrays are radix sorted and string, name and text arrays are compared natively,
+	 * SortFunc isn't called for those. Every other element type is sorted with SortFunc.
+	 *
+	 *@param	TargetArray		The array to sort
+	 *@param	SortFunc		Return true if the element at index A goes before the element at index B. Only used for struct, object and other non native element types.
+	 *@param	stable			Keep the order of elements which compare equal. Always the case for the radix sorted types.
+	 *@param	descending		Sort largest first, or reverse the order defined by SortFunc
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Sort", CompactNodeTitle = "SORT", ArrayParm = "TargetArray", Keywords = "sort order", AdvancedDisplay = "stable,descending", AutoCreateRefTerm = "SortFunc"), Category="RyRuntime|Array")
+	static void Array_Sort(const TArray<int32>& TargetArray, const FRyGenericArraySort& SortFunc, const bool stable = false, const bool descending = false);
 
-	static void GenericArray_Sort(const void* TargetArray, const FArrayProperty* ArrayProp, const void* DelegateAddr, const FDelegateProperty* DelegateProperty);
+	static void GenericArray_Sort(const void* TargetArray, const FArrayProperty* ArrayProp, const FRyGenericArraySort& SortFunc, const bool stable, const bool descending);
 	DECLARE_FUNCTION(execArray_Sort)
 	{
 		Stack.MostRecentProperty = nullptr;
@@ -152,14 +166,482 @@ public:
 			Stack.bArrayContextFailed = true;
 			return;
 		}
-		
-		Stack.StepCompiledIn<FDelegateProperty>(NULL);
-		void* DelegateAddr = Stack.MostRecentPropertyAddress;
-		FDelegateProperty* DelegateProperty = CastField<FDelegateProperty>(Stack.MostRecentProperty);
+
+		P_GET_PROPERTY(FDelegateProperty, SortFunc);
+		P_GET_UBOOL(stable);
+		P_GET_UBOOL(descending);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		GenericArray_Sort(ArrayAddr, ArrayProperty, FRyGenericArraySort(SortFunc), stable, descending);
+		P_NATIVE_END;
+	}
+
+	/* 
+	 * Find an item in an array sorted with Sort using a binary search, O(log n) instead of the O(n) of Find.
+	 * Only works for element types Sort orders natively: integers, floats, enums, bools, strings, names and text.
+	 *
+	 *@param	TargetArray		The sorted array to search
+	 *@param	Item			The item to look for
+	 *@param	descending		True if the array was sorted largest first
+	 *@return	The index of an element equal to Item, or -1 if there isn't one
+	*/
+	UFUNCTION(BlueprintPure, CustomThunk, meta=(DisplayName = "Binary Search", CompactNodeTitle = "BINARY SEARCH", ArrayParm = "TargetArray", ArrayTypeDependentParams = "Item", AutoCreateRefTerm = "Item", AdvancedDisplay = "descending", Keywords = "find sorted binary search", BlueprintThreadSafe), Category="RyRuntime|Array")
+	static int32 Array_BinarySearch(const TArray<int32>& TargetArray, const int32& Item, const bool descending = false);
+
+	static int32 GenericArray_BinarySearch(const void* TargetArray, const FArrayProperty* ArrayProp, const void* Item, const bool descending);
+	DECLARE_FUNCTION(execArray_BinarySearch)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		// Since 'Item' isn't really an int, step the stack manually
+		// We use the array inner type to understand what we are searching for (the size)
+		const FProperty* InnerProp = ArrayProperty->Inner;
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) || ENGINE_MAJOR_VERSION > 5
+		const int32 PropertySize = InnerProp->GetElementSize() * InnerProp->ArrayDim;
+#else
+		const int32 PropertySize = InnerProp->ElementSize * InnerProp->ArrayDim;
+#endif
+		void* StorageSpace = FMemory_Alloca(PropertySize);
+		InnerProp->InitializeValue(StorageSpace);
+
+		Stack.MostRecentPropertyAddress = NULL;
+		Stack.StepCompiledIn<FProperty>(StorageSpace);
+		void* ItemPtr = (Stack.MostRecentPropertyAddress != NULL && Stack.MostRecentProperty->GetClass() == InnerProp->GetClass()) ? Stack.MostRecentPropertyAddress : StorageSpace;
+
+		P_GET_UBOOL(descending);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		*(int32*)RESULT_PARAM = GenericArray_BinarySearch(ArrayAddr, ArrayProperty, ItemPtr, descending);
+		P_NATIVE_END;
+		InnerProp->DestroyValue(StorageSpace);
+	}
+
+	/* 
+	 * Find where an item belongs in an array sorted with Sort. Same element types as Binary Search.
+	 *
+	 *@param	TargetArray		The sorted array to search
+	 *@param	Item			The item to look for
+	 *@param	descending		True if the array was sorted largest first
+	 *@return	The index of the first element which doesn't go before Item, the array length if every element does. -1 if the element type isn't supported.
+	*/
+	UFUNCTION(BlueprintPure, CustomThunk, meta=(DisplayName = "Lower Bound", CompactNodeTitle = "LOWER BOUND", ArrayParm = "TargetArray", ArrayTypeDependentParams = "Item", AutoCreateRefTerm = "Item", AdvancedDisplay = "descending", Keywords = "find sorted binary search", BlueprintThreadSafe), Category="RyRuntime|Array")
+	static int32 Array_LowerBound(const TArray<int32>& TargetArray, const int32& Item, const bool descending = false);
+
+	static int32 GenericArray_LowerBound(const void* TargetArray, const FArrayProperty* ArrayProp, const void* Item, const bool descending);
+	DECLARE_FUNCTION(execArray_LowerBound)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		// Since 'Item' isn't really an int, step the stack manually
+		// We use the array inner type to understand what we are searching for (the size)
+		const FProperty* InnerProp = ArrayProperty->Inner;
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) || ENGINE_MAJOR_VERSION > 5
+		const int32 PropertySize = InnerProp->GetElementSize() * InnerProp->ArrayDim;
+#else
+		const int32 PropertySize = InnerProp->ElementSize * InnerProp->ArrayDim;
+#endif
+		void* StorageSpace = FMemory_Alloca(PropertySize);
+		InnerProp->InitializeValue(StorageSpace);
+
+		Stack.MostRecentPropertyAddress = NULL;
+		Stack.StepCompiledIn<FProperty>(StorageSpace);
+		void* ItemPtr = (Stack.MostRecentPropertyAddress != NULL && Stack.MostRecentProperty->GetClass() == InnerProp->GetClass()) ? Stack.MostRecentPropertyAddress : StorageSpace;
+
+		P_GET_UBOOL(descending);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		*(int32*)RESULT_PARAM = GenericArray_LowerBound(ArrayAddr, ArrayProperty, ItemPtr, descending);
+		P_NATIVE_END;
+		InnerProp->DestroyValue(StorageSpace);
+	}
+
+	/* 
+	 * Insert an item into an array sorted with Sort, keeping it sorted. Equal items are inserted after the existing ones.
+	 * Same element types as Binary Search.
+	 *
+	 *@param	TargetArray		The sorted array to insert into
+	 *@param	Item			The item to insert
+	 *@param	descending		True if the array was sorted largest first
+	 *@return	The index Item was inserted at, or -1 if the element type isn't supported
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Sorted Insert", CompactNodeTitle = "SORTED INSERT", ArrayParm = "TargetArray", ArrayTypeDependentParams = "Item", AutoCreateRefTerm = "Item", AdvancedDisplay = "descending", Keywords = "add insert sorted"), Category="RyRuntime|Array")
+	static int32 Array_SortedInsert(const TArray<int32>& TargetArray, const int32& Item, const bool descending = false);
+
+	static int32 GenericArray_SortedInsert(const void* TargetArray, const FArrayProperty* ArrayProp, const void* Item, const bool descending);
+	DECLARE_FUNCTION(execArray_SortedInsert)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		// Since 'Item' isn't really an int, step the stack manually
+		// We use the array inner type to understand what we are searching for (the size)
+		const FProperty* InnerProp = ArrayProperty->Inner;
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) || ENGINE_MAJOR_VERSION > 5
+		const int32 PropertySize = InnerProp->GetElementSize() * InnerProp->ArrayDim;
+#else
+		const int32 PropertySize = InnerProp->ElementSize * InnerProp->ArrayDim;
+#endif
+		void* StorageSpace = FMemory_Alloca(PropertySize);
+		InnerProp->InitializeValue(StorageSpace);
+
+		Stack.MostRecentPropertyAddress = NULL;
+		Stack.StepCompiledIn<FProperty>(StorageSpace);
+		void* ItemPtr = (Stack.MostRecentPropertyAddress != NULL && Stack.MostRecentProperty->GetClass() == InnerProp->GetClass()) ? Stack.MostRecentPropertyAddress : StorageSpace;
+
+		P_GET_UBOOL(descending);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		*(int32*)RESULT_PARAM = GenericArray_SortedInsert(ArrayAddr, ArrayProperty, ItemPtr, descending);
+		P_NATIVE_END;
+		InnerProp->DestroyValue(StorageSpace);
+	}
+
+	/* 
+	 * Remove duplicate elements.
+	 * Elements are compared with Identical and hashed with GetValueTypeHash into a temporary hash set, so this is O(n)
+	 * rather than the O(n^2) of AddUnique. Element types without a hash function still work but fall back to O(n^2).
+	 * The result keeps the order elements first appear in and has no duplicates.
+	 *
+	 *@param	TargetArray		The array to remove duplicates from
+	 *@param	Result			The result, empty if inPlace is set
+	 *@param	inPlace			Write the result into TargetArray instead of Result, reusing its memory
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Unique", CompactNodeTitle = "UNIQUE", ArrayParm = "TargetArray,Result", ArrayTypeDependentParams = "Result", AdvancedDisplay = "inPlace", Keywords = "unique distinct duplicates remove set"), Category="RyRuntime|Array")
+	static void Array_Unique(const TArray<int32>& TargetArray, TArray<int32>& Result, const bool inPlace = false);
+
+	static void GenericArray_Unique(const void* TargetArray, const FArrayProperty* TargetArrayProp, void* Result, const FArrayProperty* ResultProp, const bool inPlace);
+	DECLARE_FUNCTION(execArray_Unique)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* TargetArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* TargetArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!TargetArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ResultProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ResultProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		P_GET_UBOOL(inPlace);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		GenericArray_Unique(TargetArrayAddr, TargetArrayProperty, ResultAddr, ResultProperty, inPlace);
+		P_NATIVE_END;
+	}
+
+	/* 
+	 * Combine the elements of both arrays.
+	 * Hashes elements the same way as Unique. The result keeps the order elements first appear in and has no duplicates.
+	 *
+	 *@param	TargetArray		The array to combine with OtherArray
+	 *@param	OtherArray		The array to compare against
+	 *@param	Result			The result, empty if inPlace is set
+	 *@param	inPlace			Write the result into TargetArray instead of Result, reusing its memory
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Union", CompactNodeTitle = "UNION", ArrayParm = "TargetArray,OtherArray,Result", ArrayTypeDependentParams = "OtherArray,Result", AdvancedDisplay = "inPlace", Keywords = "union combine merge set"), Category="RyRuntime|Array")
+	static void Array_Union(const TArray<int32>& TargetArray, const TArray<int32>& OtherArray, TArray<int32>& Result, const bool inPlace = false);
+
+	static void GenericArray_Union(const void* TargetArray, const FArrayProperty* TargetArrayProp, const void* OtherArray, const FArrayProperty* OtherArrayProp, void* Result, const FArrayProperty* ResultProp, const bool inPlace);
+	DECLARE_FUNCTION(execArray_Union)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* TargetArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* TargetArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!TargetArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* OtherArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* OtherArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!OtherArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ResultProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ResultProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		P_GET_UBOOL(inPlace);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		GenericArray_Union(TargetArrayAddr, TargetArrayProperty, OtherArrayAddr, OtherArrayProperty, ResultAddr, ResultProperty, inPlace);
+		P_NATIVE_END;
+	}
+
+	/* 
+	 * Keep the elements which are in both arrays.
+	 * Hashes elements the same way as Unique. The result keeps the order elements first appear in and has no duplicates.
+	 *
+	 *@param	TargetArray		The array to intersect with OtherArray
+	 *@param	OtherArray		The array to compare against
+	 *@param	Result			The result, empty if inPlace is set
+	 *@param	inPlace			Write the result into TargetArray instead of Result, reusing its memory
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Intersect", CompactNodeTitle = "INTERSECT", ArrayParm = "TargetArray,OtherArray,Result", ArrayTypeDependentParams = "OtherArray,Result", AdvancedDisplay = "inPlace", Keywords = "intersect intersection common set"), Category="RyRuntime|Array")
+	static void Array_Intersect(const TArray<int32>& TargetArray, const TArray<int32>& OtherArray, TArray<int32>& Result, const bool inPlace = false);
+
+	static void GenericArray_Intersect(const void* TargetArray, const FArrayProperty* TargetArrayProp, const void* OtherArray, const FArrayProperty* OtherArrayProp, void* Result, const FArrayProperty* ResultProp, const bool inPlace);
+	DECLARE_FUNCTION(execArray_Intersect)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* TargetArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* TargetArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!TargetArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* OtherArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* OtherArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!OtherArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ResultProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ResultProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		P_GET_UBOOL(inPlace);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		GenericArray_Intersect(TargetArrayAddr, TargetArrayProperty, OtherArrayAddr, OtherArrayProperty, ResultAddr, ResultProperty, inPlace);
+		P_NATIVE_END;
+	}
+
+	/* 
+	 * Keep the elements of TargetArray which aren't in OtherArray.
+	 * Hashes elements the same way as Unique. The result keeps the order elements first appear in and has no duplicates.
+	 *
+	 *@param	TargetArray		The array to remove the elements of OtherArray from
+	 *@param	OtherArray		The array to compare against
+	 *@param	Result			The result, empty if inPlace is set
+	 *@param	inPlace			Write the result into TargetArray instead of Result, reusing its memory
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Difference", CompactNodeTitle = "DIFFERENCE", ArrayParm = "TargetArray,OtherArray,Result", ArrayTypeDependentParams = "OtherArray,Result", AdvancedDisplay = "inPlace", Keywords = "difference subtract except set"), Category="RyRuntime|Array")
+	static void Array_Difference(const TArray<int32>& TargetArray, const TArray<int32>& OtherArray, TArray<int32>& Result, const bool inPlace = false);
+
+	static void GenericArray_Difference(const void* TargetArray, const FArrayProperty* TargetArrayProp, const void* OtherArray, const FArrayProperty* OtherArrayProp, void* Result, const FArrayProperty* ResultProp, const bool inPlace);
+	DECLARE_FUNCTION(execArray_Difference)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* TargetArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* TargetArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!TargetArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* OtherArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* OtherArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!OtherArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ResultAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ResultProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ResultProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		P_GET_UBOOL(inPlace);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		GenericArray_Difference(TargetArrayAddr, TargetArrayProperty, OtherArrayAddr, OtherArrayProperty, ResultAddr, ResultProperty, inPlace);
+		P_NATIVE_END;
+	}
+
+	/* 
+	 * Make room for at least Capacity elements so adding up to that many doesn't reallocate.
+	 * Filling a large array without reserving first reallocates and copies it every time it grows.
+	 * Removing elements can give the reserved memory back, like it does for native arrays.
+	 *
+	 *@param	TargetArray		The array to reserve memory for
+	 *@param	Capacity		The number of elements to make room for, does nothing if the array already has room for this many
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Reserve", CompactNodeTitle = "RESERVE", ArrayParm = "TargetArray", Keywords = "reserve capacity memory slack"), Category="RyRuntime|Array")
+	static void Array_Reserve(const TArray<int32>& TargetArray, const int32 Capacity);
+
+	static void GenericArray_Reserve(const void* TargetArray, const FArrayProperty* ArrayProp, const int32 Capacity);
+	DECLARE_FUNCTION(execArray_Reserve)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		P_GET_PROPERTY(FIntProperty, Capacity);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		GenericArray_Reserve(ArrayAddr, ArrayProperty, Capacity);
+		P_NATIVE_END;
+	}
+
+	/* 
+	 * Free the memory the array has reserved beyond its length
+	 *
+	 *@param	TargetArray		The array to shrink
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Shrink", CompactNodeTitle = "SHRINK", ArrayParm = "TargetArray", Keywords = "shrink capacity memory slack free"), Category="RyRuntime|Array")
+	static void Array_Shrink(const TArray<int32>& TargetArray);
+
+	static void GenericArray_Shrink(const void* TargetArray, const FArrayProperty* ArrayProp);
+	DECLARE_FUNCTION(execArray_Shrink)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
 
 		P_FINISH;
 		P_NATIVE_BEGIN;
-		GenericArray_Sort(ArrayAddr, ArrayProperty, DelegateAddr, DelegateProperty);
+		GenericArray_Shrink(ArrayAddr, ArrayProperty);
 		P_NATIVE_END;
-	}*/
+	}
+
+	/* 
+	 * Get the number of elements the array has memory for
+	 *
+	 *@param	TargetArray		The array to check
+	 *@return	The capacity, at least the length of the array
+	*/
+	UFUNCTION(BlueprintPure, CustomThunk, meta=(DisplayName = "Get Capacity", CompactNodeTitle = "CAPACITY", ArrayParm = "TargetArray", Keywords = "capacity memory slack max", BlueprintThreadSafe), Category="RyRuntime|Array")
+	static int32 Array_GetCapacity(const TArray<int32>& TargetArray);
+
+	static int32 GenericArray_GetCapacity(const void* TargetArray, const FArrayProperty* ArrayProp);
+	DECLARE_FUNCTION(execArray_GetCapacity)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		*(int32*)RESULT_PARAM = GenericArray_GetCapacity(ArrayAddr, ArrayProperty);
+		P_NATIVE_END;
+	}
+
+	/* 
+	 * Remove an item by moving the last item into its place. O(1) instead of shifting every later item down,
+	 * use it when the order of the array doesn't matter.
+	 *
+	 *@param	TargetArray		The array to remove from
+	 *@param	IndexToRemove	The index of the item to remove
+	 *@return	True if the index was valid and the item was removed
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, meta=(DisplayName = "Remove Index Swap", CompactNodeTitle = "REMOVE INDEX SWAP", ArrayParm = "TargetArray", Keywords = "remove swap unordered"), Category="RyRuntime|Array")
+	static bool Array_RemoveAtSwap(const TArray<int32>& TargetArray, const int32 IndexToRemove);
+
+	static bool GenericArray_RemoveAtSwap(const void* TargetArray, const FArrayProperty* ArrayProp, const int32 IndexToRemove);
+	DECLARE_FUNCTION(execArray_RemoveAtSwap)
+	{
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		void* ArrayAddr = Stack.MostRecentPropertyAddress;
+		FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		if (!ArrayProperty)
+		{
+			Stack.bArrayContextFailed = true;
+			return;
+		}
+
+		P_GET_PROPERTY(FIntProperty, IndexToRemove);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		*(bool*)RESULT_PARAM = GenericArray_RemoveAtSwap(ArrayAddr, ArrayProperty, IndexToRemove);
+		P_NATIVE_END;
+	}
 };
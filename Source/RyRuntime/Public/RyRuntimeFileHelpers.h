@@ -4,8 +4,116 @@
 
 #include "Runtime/Core/Public/HAL/Platform.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/LatentActionManager.h"
 #include "RyRuntimeFileHelpers.generated.h"
 
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/** The result of an asynchronous file request */
+UENUM(BlueprintType)
+enum class ERyAsyncFileResult : uint8
+{
+	/** The request completed successfully */
+	Success,
+	/** The file operation failed */
+	Failed,
+	/** The request was canceled before it completed */
+	Canceled,
+	/** Too many requests were already queued, the request was never started */
+	QueueFull,
+};
+
+/** Compression formats supported by the compressed file helpers */
+UENUM(BlueprintType)
+enum class ERyCompressionFormat : uint8
+{
+	Zlib,
+	Gzip,
+	LZ4,
+	/** Oodle is the fastest and smallest, if it is available in this build of the engine */
+	Oodle,
+};
+
+/** Trade compression speed against compressed size */
+UENUM(BlueprintType)
+enum class ERyCompressionLevel : uint8
+{
+	Default,
+	/** Compress faster at the cost of a larger output */
+	Fastest,
+	/** Compress smaller at the cost of speed */
+	Smallest,
+};
+
+/** Hash algorithms supported by the file hashing helpers */
+UENUM(BlueprintType)
+enum class ERyFileHashAlgorithm : uint8
+{
+	/** Fast non-cryptographic 64 bit hash. Requires Engine 5.1 or greater. */
+	XxHash64,
+	/** Fast non-cryptographic 128 bit hash. Requires Engine 5.1 or greater. */
+	XxHash128,
+	/** 160 bit SHA-1 */
+	SHA1,
+};
+
+/** Throughput of a file stream */
+USTRUCT(BlueprintType)
+struct FRyFileStreamStats
+{
+	GENERATED_BODY()
+
+	/** The number of bytes read from the file */
+	UPROPERTY(BlueprintReadOnly, Category = "FileStreamStats")
+	int64 BytesRead = 0;
+
+	/** The number of chunks handed to the chunk callback */
+	UPROPERTY(BlueprintReadOnly, Category = "FileStreamStats")
+	int32 ChunksRead = 0;
+
+	/** Wall time from the start of the stream until it ended */
+	UPROPERTY(BlueprintReadOnly, Category = "FileStreamStats")
+	float Seconds = 0.0f;
+
+	/** BytesRead / Seconds */
+	UPROPERTY(BlueprintReadOnly, Category = "FileStreamStats")
+	float BytesPerSecond = 0.0f;
+};
+
+/** A file to write in a batch of background writes */
+USTRUCT(BlueprintType)
+struct FRyFileWriteJob
+{
+	GENERATED_BODY()
+
+	/** The full path to the file to write to */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileWriteJob")
+	FString FilePath;
+
+	/** The bytes to write out to the file */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileWriteJob")
+	TArray<uint8> Bytes;
+};
+
+/** The bytes of one range read by URyFileHandle::ReadRanges */
+USTRUCT(BlueprintType)
+struct FRyFileReadSlice
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "FileReadSlice")
+	TArray<uint8> Bytes;
+};
+
+DECLARE_DYNAMIC_DELEGATE_RetVal_TwoParams(bool, FRyFileChunkVisitor, const TArray<uint8>&, Chunk, const int64, Offset);
+typedef TFunction<bool(TArrayView<const uint8> Chunk, const int64 Offset)> RyNativeFileChunkSig;
+DECLARE_DYNAMIC_DELEGATE_RetVal_TwoParams(bool, FRyFileLineVisitor, const FString&, Line, const int64, LineNumber);
+
+typedef TFunction<void(const ERyAsyncFileResult Result, TArray<uint8>& Bytes)> RyNativeAsyncBytesReadSig;
+typedef TFunction<void(const ERyAsyncFileResult Result, FString& String)> RyNativeAsyncStringReadSig;
+typedef TFunction<void(const ERyAsyncFileResult Result)> RyNativeAsyncWriteSig;
+
 /**
  * A handle to a file
  * If this object is garbage collected or destroyed
@@ -16,7 +124,7 @@ class RYRUNTIME_API URyFileHandle : public UObject
 	GENERATED_BODY()
 public:
 
-	URyFileHandle() : Handle(nullptr), CanRead(false), CanWrite(false)
+	URyFileHandle() : Handle(nullptr), CanRead(false), CanWrite(false), WriteBufferSize(0), Flusher(nullptr)
 	{
 	}
 	
@@ -52,12 +160,61 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHandle")
 	bool Read(TArray<uint8>& bytesTo, const int64 numBytes);
 
+	/**
+	 * Read many ranges of the file in one call. The ranges are sorted and ranges which touch or are within maxGap bytes
+	 * of each other are merged, so packed files with many small records are read with as few file reads as possible.
+	 * The current read position is left unchanged.
+	 * @param offsets The offset of each range from the start of the file
+	 * @param sizes The number of bytes in each range, must be the same length as offsets
+	 * @param slicesOut The bytes of each range in the same order as offsets
+	 * @param maxGap Ranges closer than this many bytes are read together, reading the unused bytes between them
+	 * @return False if a range is outside of the file, larger than 2GB or a read failed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHandle", meta=(AdvancedDisplay = "maxGap"))
+	bool ReadRanges(const TArray<int64>& offsets, const TArray<int64>& sizes, TArray<FRyFileReadSlice>& slicesOut, const int64 maxGap = 4096);
+
+	/**
+	 * Native version of ReadRanges which packs every range into one array instead of an array per range.
+	 * Ranges aren't limited to 2GB.
+	 * @param bytesOut The bytes of every range back to back in the same order as offsets
+	 * @param sliceOffsetsOut The offset of each range's bytes in bytesOut
+	 */
+	bool ReadRangesPacked(TArrayView<const int64> offsets, TArrayView<const int64> sizes, TArray64<uint8>& bytesOut, TArray<int64>& sliceOffsetsOut, const int64 maxGap = 4096);
+
 	/**
 	 * Write to the file
+	 * If write buffering is enabled the bytes may be held in memory until the buffer fills or Flush is called.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHandle")
 	bool Write(const TArray<uint8>& bytesOut);
 
+	/**
+	 * Write raw bytes to the file. Native version of Write which doesn't need the bytes in an array.
+	 */
+	bool WriteRaw(const uint8* bytesOut, const int64 numBytes);
+
+	/**
+	 * Enable write buffering. Small writes are collected in memory and written to the file in one go when the buffer
+	 * fills, which is far cheaper than a file write per call when appending many small records.
+	 * Buffered bytes are written when Flush, Seek, Read or Close is called, or when the handle is destroyed.
+	 * @param bufferSize The size of the write buffer in bytes. Writes this size or larger go straight to the file.
+	 * @param backgroundFlushInterval If greater than 0, a background thread flushes the buffer every this many seconds.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHandle", meta=(AdvancedDisplay = "1"))
+	void EnableWriteBuffering(const int32 bufferSize = 65536, const float backgroundFlushInterval = 0.0f);
+
+	/**
+	 * Flush and disable write buffering, all further writes go straight to the file.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHandle")
+	void DisableWriteBuffering();
+
+	/**
+	 * Write any buffered bytes to the file and flush the file to the OS.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHandle")
+	bool Flush();
+
 	/**
 	 * Return the size of the file
 	 */
@@ -78,6 +235,97 @@ private:
 	bool CanRead;
 	bool CanWrite;
 
+	// Write any buffered bytes to the file. HandleLock must be held. On failure the bytes stay buffered.
+	bool FlushWriteBuffer();
+	void StopFlusher();
+
+	// Bytes waiting to be written when buffering is enabled
+	TArray<uint8> WriteBuffer;
+	int32 WriteBufferSize;
+
+	// Guards Handle and WriteBuffer from the background flusher
+	mutable FCriticalSection HandleLock;
+	class FRyFileHandleFlusher* Flusher;
+
+	friend class URyRuntimeFileHelpers;
+	friend class FRyFileHandleFlusher;
+};
+
+/**
+ * A read-only memory mapped view of a file.
+ * The file contents are paged in by the OS on access instead of being copied into a new array, so large files
+ * don't double peak memory. If the platform doesn't support mapping the file is read into memory once instead.
+ * If this object is garbage collected or destroyed the mapping is released.
+ */
+UCLASS(BlueprintType)
+class RYRUNTIME_API URyMappedFile : public UObject
+{
+	GENERATED_BODY()
+public:
+
+	URyMappedFile() : MappedHandle(nullptr), MappedRegion(nullptr), Loaded(false)
+	{
+	}
+
+	virtual void BeginDestroy() override;
+
+	/**
+	 * Copy a slice of the mapped file into bytesOut.
+	 * @param bytesOut The bytes copied out of the mapping
+	 * @param offset The offset in bytes into the file
+	 * @param numBytes The number of bytes at the offset to copy. Clamped to the end of the file.
+	 * @return True if any bytes were copied
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|MappedFile")
+	bool ReadSlice(TArray<uint8>& bytesOut, const int64 offset, const int64 numBytes) const;
+
+	/**
+	 * Return the size of the mapped file, or 0 if unmapped
+	 */
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|MappedFile")
+	int64 Size() const;
+
+	/**
+	 * True if the file contents are available (mapped or read by the fallback path). An empty file is valid.
+	 */
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|MappedFile")
+	bool IsValid() const;
+
+	/**
+	 * True if the file is backed by an OS memory mapping, false if the platform fallback read the file into memory
+	 */
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|MappedFile")
+	bool IsMemoryMapped() const { return MappedRegion != nullptr; }
+
+	/**
+	 * Release the mapping. Any views returned by GetView are invalid after this is called.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|MappedFile")
+	void Unmap();
+
+	/**
+	 * Get a read-only view of the file contents without copying.
+	 * The view is valid until Unmap is called or this object is destroyed.
+	 * @param offset The offset in bytes into the file
+	 * @param numBytes The number of bytes at the offset. Clamped to the end of the file.
+	 * @return The view, empty if the range is out of bounds or the file is unmapped
+	 */
+	TArrayView64<const uint8> GetView(const int64 offset = 0, const int64 numBytes = MAX_int64) const;
+
+private:
+
+	const uint8* GetData() const;
+
+	// The OS mapping, null if the platform doesn't support mapping
+	IMappedFileHandle* MappedHandle;
+	IMappedFileRegion* MappedRegion;
+
+	// Fallback storage used when mapping isn't supported
+	TArray64<uint8> FallbackBytes;
+
+	// True once the file has been mapped or read, until Unmap. Empty files are loaded with no bytes.
+	bool Loaded;
+
 	friend class URyRuntimeFileHelpers;
 };
 
@@ -96,6 +344,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers")
 	static URyFileHandle* OpenFileHandle(UObject* outer, const FString filePath, const bool forRead, const bool forWrite, bool& success);
 
+	/**
+	 * Open a read-only memory mapped view of a file. Use this over ReadAllBytesFromFile for large files to avoid
+	 * copying the whole file into memory. Falls back to reading the file if the platform does not support mapping.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers")
+	static URyMappedFile* OpenMappedFile(UObject* outer, const FString filePath, bool& success);
+
 	/**
 	 * Write an array of bytes to a file
 	 * @param filePath The full path to the file to write to
@@ -106,6 +361,99 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers")
 	static bool WriteBytesToFile(const FString filePath, const bool allowOverwrite, const TArray<uint8>& bytesOut);
 
+	/**
+	 * Write an array of bytes to a file atomically. The bytes are written to a temporary file next to filePath which is
+	 * then renamed over filePath, so a crash part way through never leaves a partially written file behind.
+	 * On Windows the old file is replaced with MoveFileEx, which swaps it in with a single rename.
+	 * NOTE: On platforms where a rename can't replace an existing file, the old file is first renamed to a .rybak next
+	 * to it. A crash in that window leaves the old contents in the .rybak and the new contents in the .rytmp file.
+	 * @param filePath The full path to the file to write to
+	 * @param allowOverwrite If true, if the file exists it will be overwritten, or the function will return false
+	 * @param bytesOut The bytes to write out to the file
+	 * @param flushToDisk If true, the temporary file is flushed to the disk before the rename so the write survives power loss
+	 * @return True if success
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers", meta = (AdvancedDisplay = "3"))
+	static bool WriteBytesToFileAtomic(const FString filePath, const bool allowOverwrite, const TArray<uint8>& bytesOut, const bool flushToDisk = false);
+
+	/**
+	 * Queue files to be written atomically (see WriteBytesToFileAtomic) on a background writer thread. Existing files are overwritten.
+	 * If a path is queued again before its previous write has started, only the latest bytes are written.
+	 * Useful for autosaves which write many small files, the caller never waits on the disk.
+	 * @param jobs The paths and bytes to write
+	 * @param flushToDisk If true, each file is flushed to the disk before it replaces the old file
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Async", meta = (AdvancedDisplay = "1"))
+	static void QueueBackgroundFileWrites(const TArray<FRyFileWriteJob>& jobs, const bool flushToDisk = false);
+
+	/**
+	 * Native version of QueueBackgroundFileWrites for a single file which takes ownership of the bytes instead of copying them.
+	 */
+	static void QueueBackgroundFileWrite(const FString& filePath, TArray<uint8>&& bytes, const bool flushToDisk = false);
+
+	/**
+	 * Block until every queued background file write has been written.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Async")
+	static void FlushBackgroundFileWrites();
+
+	/**
+	 * The number of queued background file writes which haven't started yet.
+	 */
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|FileHelpers|Async")
+	static int32 GetNumQueuedBackgroundFileWrites();
+
+	/**
+	 * Flush outstanding background file writes and stop the writer thread. Called on module shutdown.
+	 */
+	static void ShutdownBackgroundFileWriter();
+
+	/**
+	 * Compress an array of bytes and write it to a file atomically (see WriteBytesToFileAtomic).
+	 * The bytes are compressed in independent blocks in parallel and the file stores the original size and a block
+	 * table, so ReadCompressedBytesRange can decompress part of the file without reading all of it.
+	 * @param filePath The full path to the file to write to
+	 * @param allowOverwrite If true, if the file exists it will be overwritten, or the function will return false
+	 * @param bytesOut The bytes to compress and write out to the file
+	 * @param format The compression format
+	 * @param level Trade compression speed against size
+	 * @param blockSize The number of uncompressed bytes per block
+	 * @return True if success
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Compression", meta = (AdvancedDisplay = "4"))
+	static bool WriteCompressedBytesToFile(const FString filePath, const bool allowOverwrite, const TArray<uint8>& bytesOut,
+	                                       const ERyCompressionFormat format = ERyCompressionFormat::Oodle,
+	                                       const ERyCompressionLevel level = ERyCompressionLevel::Default,
+	                                       const int32 blockSize = 262144);
+
+	/**
+	 * Read and decompress all bytes of a file written by WriteCompressedBytesToFile. Blocks are decompressed in parallel.
+	 * @param filePath The full path to the file to read
+	 * @param bytesIn The decompressed bytes
+	 * @return True if success
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Compression")
+	static bool ReadCompressedBytesFromFile(const FString filePath, TArray<uint8>& bytesIn);
+
+	/**
+	 * Read and decompress a range of the original bytes of a file written by WriteCompressedBytesToFile.
+	 * Only the blocks overlapping the range are read and decompressed.
+	 * @param filePath The full path to the file to read
+	 * @param bytesIn The decompressed bytes of the range
+	 * @param offset The offset in bytes into the original uncompressed data
+	 * @param numBytes The number of bytes at the offset to read. Clamped to the end of the data.
+	 * @return True if success
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Compression")
+	static bool ReadCompressedBytesRange(const FString filePath, TArray<uint8>& bytesIn, const int64 offset, const int64 numBytes);
+
+	/**
+	 * Get the original size of the data in a file written by WriteCompressedBytesToFile without decompressing it.
+	 * @return True if the file is a valid compressed file
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Compression")
+	static bool GetCompressedFileUncompressedSize(const FString filePath, int64& uncompressedSize);
+
 	/**
 	 * Read all bytes from a file and put them into bytesIn
 	 * @param filePath The full path to the file to write to
@@ -149,6 +497,141 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers")
 	static bool LoadFileToString(UPARAM(ref)FString& Result, const FString& Filename);
 
+	/**
+	 * Read all bytes from a file on a background thread. Completes when the read is done without blocking the game thread.
+	 * If the calling object is destroyed or its latent actions are removed, the read is canceled.
+	 * @param filePath The full path to the file to read
+	 * @param bytesIn The bytes read in from the file, set when the action completes
+	 * @param result The result of the request
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Async", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void ReadAllBytesFromFileLatent(UObject* WorldContextObject, const FString filePath, TArray<uint8>& bytesIn, ERyAsyncFileResult& result, FLatentActionInfo LatentInfo);
+
+	/**
+	 * Write an array of bytes to a file on a background thread. Completes when the write is done without blocking the game thread.
+	 * NOTE: Canceling a write which has already started may still leave the file written.
+	 * @param filePath The full path to the file to write to
+	 * @param allowOverwrite If true, if the file exists it will be overwritten, or the request will fail
+	 * @param bytesOut The bytes to write out to the file
+	 * @param result The result of the request
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Async", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void WriteBytesToFileLatent(UObject* WorldContextObject, const FString filePath, const bool allowOverwrite, const TArray<uint8>& bytesOut, ERyAsyncFileResult& result, FLatentActionInfo LatentInfo);
+
+	/**
+	 * Write the FString to a file on a background thread. Completes when the write is done without blocking the game thread.
+	 * Supports all combination of ANSI/Unicode files and platforms.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Async", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void SaveStringToFileLatent(UObject* WorldContextObject, const FString& String, const FString& Filename, ERyAsyncFileResult& result, FLatentActionInfo LatentInfo);
+
+	/**
+	 * Load a text file to an FString on a background thread. Completes when the load is done without blocking the game thread.
+	 * Supports all combination of ANSI/Unicode files and platforms.
+	 * @param fileContents The loaded text, set when the action completes
+	 * @param result The result of the request
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Async", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void LoadFileToStringLatent(UObject* WorldContextObject, const FString& Filename, FString& fileContents, ERyAsyncFileResult& result, FLatentActionInfo LatentInfo);
+
+	/**
+	 * Native async versions of the file helpers. Must be called from the game thread.
+	 * The I/O runs on a pool thread and onComplete is always called on the game thread, including when the request is
+	 * canceled or rejected because the queue is full (in which case it is called before this returns).
+	 * @return The request id to pass to CancelAsyncFileRequest, or INDEX_NONE if the request was rejected
+	 */
+	static int32 ReadAllBytesFromFileAsync(const FString& filePath, RyNativeAsyncBytesReadSig onComplete);
+	static int32 WriteBytesToFileAsync(const FString& filePath, const bool allowOverwrite, TArray<uint8> bytesOut, RyNativeAsyncWriteSig onComplete);
+	static int32 SaveStringToFileAsync(const FString& String, const FString& Filename, RyNativeAsyncWriteSig onComplete);
+	static int32 LoadFileToStringAsync(const FString& Filename, RyNativeAsyncStringReadSig onComplete);
+
+	/**
+	 * Stream a file in fixed size chunks, calling OnChunk for each one in order.
+	 * Only two chunks are ever held in memory and the next chunk is read in the background while the current one is
+	 * processed, so memory use is flat no matter how large the file is.
+	 * @param filePath The full path to the file to stream
+	 * @param OnChunk Called with each chunk and its offset into the file. Return false to stop streaming. The chunk array is reused, copy it to keep it.
+	 * @param stats The number of bytes read and the throughput, set when the action completes
+	 * @param success False if the file couldn't be opened or a read failed
+	 * @param chunkSize The size of each chunk in bytes. The last chunk may be smaller.
+	 * @param maxChunksPerTick The maximum number of chunks handed to OnChunk per tick
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Async", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject", AdvancedDisplay = "chunkSize,maxChunksPerTick"))
+	static void StreamFileChunksLatent(UObject* WorldContextObject, const FString filePath, FRyFileChunkVisitor OnChunk, FRyFileStreamStats& stats, bool& success, FLatentActionInfo LatentInfo,
+	                                   const int32 chunkSize = 1048576, const int32 maxChunksPerTick = 4);
+
+	/**
+	 * Native version of StreamFileChunksLatent which streams the whole file before returning.
+	 * The next chunk is read asynchronously while onChunk processes the current one. The chunk view is only valid during the call.
+	 * @return False if the file couldn't be opened or a read failed. Stopping early by returning false from onChunk is not a failure.
+	 */
+	static bool StreamFileChunks(const FString& filePath, const int32 chunkSize, RyNativeFileChunkSig onChunk, FRyFileStreamStats& stats);
+
+	/**
+	 * Visit each line of a text file without loading the whole file into memory, see FRyFileLineReader for native use.
+	 * Up to batchSize lines are handed to OnLine per tick so huge files don't stall the game thread.
+	 * @param filePath The full path to a UTF-8 or ANSI text file
+	 * @param OnLine Called with each line, without its line ending, and its 1 based line number. Return false to stop.
+	 * @param numLines The number of lines visited
+	 * @param success False if the file couldn't be opened or a read failed
+	 * @param batchSize The maximum number of lines handed to OnLine per tick
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Async", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject", AdvancedDisplay = "batchSize"))
+	static void ForEachLineInFileLatent(UObject* WorldContextObject, const FString filePath, FRyFileLineVisitor OnLine, int64& numLines, bool& success, FLatentActionInfo LatentInfo,
+	                                    const int32 batchSize = 1000);
+
+	/**
+	 * Hash a file without loading it into memory. The file is streamed in chunks, see StreamFileChunks.
+	 * @param filePath The full path to the file to hash
+	 * @param algorithm The hash algorithm
+	 * @param hash The hash as a lower case hex string
+	 * @param stats The number of bytes hashed and the throughput
+	 * @return True if the file was read and hashed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Hash")
+	static bool HashFile(const FString& filePath, const ERyFileHashAlgorithm algorithm, FString& hash, FRyFileStreamStats& stats);
+
+	/**
+	 * Hash many files in parallel across the task graph.
+	 * @param filePaths The full paths to the files to hash
+	 * @param algorithm The hash algorithm
+	 * @param hashes The hash of each file as a lower case hex string, in the same order as filePaths. Empty for files which failed.
+	 * @param stats The total number of bytes hashed and the overall throughput
+	 * @return True if every file was read and hashed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Hash")
+	static bool HashFiles(const TArray<FString>& filePaths, const ERyFileHashAlgorithm algorithm, TArray<FString>& hashes, FRyFileStreamStats& stats);
+
+	/**
+	 * Latent version of HashFiles which hashes on background threads without blocking the game thread.
+	 * Runs through the async file request queue, see SetAsyncFileQueueLimits.
+	 * @param result Success if every file was hashed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Hash", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void HashFilesLatent(UObject* WorldContextObject, const TArray<FString>& filePaths, const ERyFileHashAlgorithm algorithm, TArray<FString>& hashes,
+	                            FRyFileStreamStats& stats, ERyAsyncFileResult& result, FLatentActionInfo LatentInfo);
+
+	/**
+	 * Cancel an asynchronous file request started with one of the native async file helpers.
+	 * Native only, the latent nodes cancel their request when the calling object is destroyed or its latent actions are removed.
+	 * @return True if the request was found. Its completion callback will report Canceled.
+	 */
+	static bool CancelAsyncFileRequest(const int32 requestId);
+
+	/**
+	 * The number of asynchronous file requests either running or waiting in the queue
+	 */
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|FileHelpers|Async")
+	static int32 GetNumAsyncFileRequests();
+
+	/**
+	 * Set the limits of the asynchronous file request queue.
+	 * @param maxRunning The maximum number of requests doing I/O at the same time. Defaults to 4.
+	 * @param maxQueued The maximum number of requests waiting to run. Requests past this are rejected with QueueFull. Defaults to 128.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|FileHelpers|Async")
+	static void SetAsyncFileQueueLimits(const int32 maxRunning = 4, const int32 maxQueued = 128);
+
 	/**
 	* Checks to see if a filename is valid for saving.
 	* A filename must be under FPlatformMisc::GetMaxPathLength() to be saved
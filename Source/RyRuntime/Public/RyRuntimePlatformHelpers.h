@@ -4,6 +4,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Runtime/Launch/Resources/Version.h"
+#include "Engine/LatentActionManager.h"
 
 #include "RyRuntimePlatformHelpers.generated.h"
 
@@ -25,6 +26,323 @@ enum class ERyIterateDirectoryOut : uint8
     DirectoriesOnly = 2,
 };
 
+/** Stat information of a file or directory, gathered in the same call that finds it */
+USTRUCT(BlueprintType)
+struct FRyFileInfo
+{
+    GENERATED_BODY()
+
+    /** The full path to the file or directory */
+    UPROPERTY(BlueprintReadOnly, Category = "FileInfo")
+    FString Path;
+
+    /** The size of the file in bytes, -1 for directories */
+    UPROPERTY(BlueprintReadOnly, Category = "FileInfo")
+    int64 Size = -1;
+
+    /** The time the file or directory was created, FDateTime::MinValue if not known */
+    UPROPERTY(BlueprintReadOnly, Category = "FileInfo")
+    FDateTime CreationTime;
+
+    /** The time the file or directory was last accessed, FDateTime::MinValue if not known */
+    UPROPERTY(BlueprintReadOnly, Category = "FileInfo")
+    FDateTime AccessTime;
+
+    /** The time the file or directory was last modified, FDateTime::MinValue if not known */
+    UPROPERTY(BlueprintReadOnly, Category = "FileInfo")
+    FDateTime ModificationTime;
+
+    UPROPERTY(BlueprintReadOnly, Category = "FileInfo")
+    bool IsDirectory = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "FileInfo")
+    bool IsReadOnly = false;
+};
+
+/**
+ * Describes which paths a directory scan keeps. Compiled once into an FRyCompiledFileFilter which matches paths natively.
+ * Patterns are globs where * matches any run of characters and ? matches one character. A pattern containing a /
+ * is matched against the path relative to the scanned directory, otherwise against the file or directory name.
+ */
+USTRUCT(BlueprintType)
+struct FRyFileFilterSpec
+{
+    GENERATED_BODY()
+
+    /** Files must match one of these patterns, ie "*.sav" or "Saves/Slot?.sav". Empty keeps all files. */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileFilterSpec")
+    TArray<FString> IncludePatterns;
+
+    /** Files matching any of these patterns are skipped */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileFilterSpec")
+    TArray<FString> ExcludePatterns;
+
+    /** Files must have one of these extensions, with or without the dot. Empty keeps all extensions. */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileFilterSpec")
+    TArray<FString> Extensions;
+
+    /** Directories matching any of these patterns are skipped along with everything inside them, ie ".git" or "Intermediate" */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileFilterSpec")
+    TArray<FString> ExcludeDirectories;
+
+    /** Files smaller than this many bytes are skipped */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileFilterSpec")
+    int64 MinSize = 0;
+
+    /** Files larger than this many bytes are skipped. Negative for no limit. */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileFilterSpec")
+    int64 MaxSize = -1;
+
+    /** Files last modified before this time are skipped. Leave at 0 for no limit. */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileFilterSpec")
+    FDateTime ModifiedAfter;
+
+    /** Files last modified after this time are skipped. Leave at 0 for no limit. */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileFilterSpec")
+    FDateTime ModifiedBefore;
+
+    /** If true, patterns and extensions are matched case sensitively */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FileFilterSpec")
+    bool CaseSensitive = false;
+};
+
+/** Progress of a directory tree copy or move */
+USTRUCT(BlueprintType)
+struct FRyFileTransferProgress
+{
+    GENERATED_BODY()
+
+    /** The number of bytes copied so far */
+    UPROPERTY(BlueprintReadOnly, Category = "FileTransferProgress")
+    int64 BytesCopied = 0;
+
+    /** The total number of bytes to copy, known once the source has been scanned */
+    UPROPERTY(BlueprintReadOnly, Category = "FileTransferProgress")
+    int64 TotalBytes = 0;
+
+    /** The number of files copied or moved so far */
+    UPROPERTY(BlueprintReadOnly, Category = "FileTransferProgress")
+    int32 FilesCopied = 0;
+
+    /** The number of files which couldn't be copied or moved */
+    UPROPERTY(BlueprintReadOnly, Category = "FileTransferProgress")
+    int32 FilesFailed = 0;
+
+    /** The total number of files, known once the source has been scanned */
+    UPROPERTY(BlueprintReadOnly, Category = "FileTransferProgress")
+    int32 TotalFiles = 0;
+
+    /** Wall time since the transfer started */
+    UPROPERTY(BlueprintReadOnly, Category = "FileTransferProgress")
+    float Seconds = 0.0f;
+
+    /** Throughput in megabytes per second */
+    UPROPERTY(BlueprintReadOnly, Category = "FileTransferProgress")
+    float MegabytesPerSecond = 0.0f;
+};
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FRyFileTransferProgressDelegate, const FRyFileTransferProgress&, Progress);
+
+/** Progress of a background directory delete */
+USTRUCT(BlueprintType)
+struct FRyDeleteProgress
+{
+    GENERATED_BODY()
+
+    /** The number of files deleted so far */
+    UPROPERTY(BlueprintReadOnly, Category = "DeleteProgress")
+    int32 FilesDeleted = 0;
+
+    /** The total number of files to delete, known once the directory has been scanned */
+    UPROPERTY(BlueprintReadOnly, Category = "DeleteProgress")
+    int32 TotalFiles = 0;
+
+    /** The number of bytes freed so far */
+    UPROPERTY(BlueprintReadOnly, Category = "DeleteProgress")
+    int64 BytesDeleted = 0;
+
+    /** The total number of bytes to free, known once the directory has been scanned */
+    UPROPERTY(BlueprintReadOnly, Category = "DeleteProgress")
+    int64 TotalBytes = 0;
+
+    /** Wall time since the delete started */
+    UPROPERTY(BlueprintReadOnly, Category = "DeleteProgress")
+    float Seconds = 0.0f;
+
+    /** True once the delete finished or was canceled */
+    UPROPERTY(BlueprintReadOnly, Category = "DeleteProgress")
+    bool Done = false;
+};
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FRyDeleteProgressDelegate, const FRyDeleteProgress&, Progress);
+typedef TFunction<void(const bool Success)> RyNativeDeleteCompleteSig;
+
+DECLARE_DYNAMIC_DELEGATE_RetVal_OneParam(float, FRyParallelForBody, const int32, Index);
+typedef TFunction<void(const int32 Index)> RyNativeParallelForBodySig;
+typedef TFunction<void()> RyNativeParallelForCompleteSig;
+
+/**
+ * A named event registered once with URyRuntimePlatformHelpers::RegisterNamedEvent.
+ * Beginning an event through a handle passes the cached name straight to the profiler with no string conversion or allocation.
+ */
+USTRUCT(BlueprintType)
+struct FRyNamedEventHandle
+{
+    GENERATED_BODY()
+
+    /** The id of the event in the registry, INDEX_NONE if not registered */
+    UPROPERTY(BlueprintReadOnly, Category = "NamedEventHandle")
+    int32 Id = INDEX_NONE;
+
+    /** Native cache of the registered name, lives as long as the process. Looked up by Id if not set. */
+    const TCHAR* Text = nullptr;
+    FColor Color = FColor::White;
+};
+
+/**
+ * A named custom stat registered once with URyRuntimePlatformHelpers::RegisterNamedStat.
+ */
+USTRUCT(BlueprintType)
+struct FRyNamedStatHandle
+{
+    GENERATED_BODY()
+
+    /** The id of the stat in the registry, INDEX_NONE if not registered */
+    UPROPERTY(BlueprintReadOnly, Category = "NamedStatHandle")
+    int32 Id = INDEX_NONE;
+
+    /** Native cache of the registered strings, live as long as the process. Looked up by Id if not set. */
+    const TCHAR* Text = nullptr;
+    const TCHAR* Graph = nullptr;
+    const TCHAR* Unit = nullptr;
+};
+
+/** A dynamic Unreal Insights counter registered with URyRuntimePlatformHelpers::RegisterTraceCounter */
+USTRUCT(BlueprintType)
+struct FRyTraceCounterHandle
+{
+    GENERATED_BODY()
+
+    /** The id of the counter in the registry, INDEX_NONE if not registered */
+    UPROPERTY(BlueprintReadOnly, Category = "TraceCounterHandle")
+    int32 Id = INDEX_NONE;
+};
+
+/** A named Unreal Insights CPU timing scope registered with URyRuntimePlatformHelpers::RegisterTraceScope */
+USTRUCT(BlueprintType)
+struct FRyTraceScopeHandle
+{
+    GENERATED_BODY()
+
+    /** The id of the scope in the registry, INDEX_NONE if not registered */
+    UPROPERTY(BlueprintReadOnly, Category = "TraceScopeHandle")
+    int32 Id = INDEX_NONE;
+};
+
+/** The files which changed between two scans of a URyDirectorySnapshot */
+USTRUCT(BlueprintType)
+struct FRyDirectorySnapshotDiff
+{
+    GENERATED_BODY()
+
+    /** Full paths of files which didn't exist in the previous scan */
+    UPROPERTY(BlueprintReadOnly, Category = "DirectorySnapshotDiff")
+    TArray<FString> Added;
+
+    /** Full paths of files which no longer exist */
+    UPROPERTY(BlueprintReadOnly, Category = "DirectorySnapshotDiff")
+    TArray<FString> Removed;
+
+    /** Full paths of files whose size or modification time changed */
+    UPROPERTY(BlueprintReadOnly, Category = "DirectorySnapshotDiff")
+    TArray<FString> Modified;
+};
+
+/**
+ * A record of the files in a directory tree (paths, sizes and modification times) which can be refreshed to find
+ * the files added, removed or modified since the last scan.
+ * Refreshing only lists directories whose own modification time changed, directories which didn't change reuse their
+ * previous listing. Snapshots can be saved to a compact binary file so a later run can diff against the previous one.
+ * Create with URyRuntimePlatformHelpers::CaptureDirectorySnapshot or LoadDirectorySnapshot.
+ */
+UCLASS(BlueprintType)
+class RYRUNTIME_API URyDirectorySnapshot : public UObject
+{
+    GENERATED_BODY()
+public:
+
+    /**
+     * Scan rootPath and replace the contents of the snapshot.
+     * @param rootPath The directory to snapshot
+     * @param recursive If true, sub directories are included
+     * @return False if rootPath isn't a directory
+     */
+    UFUNCTION(BlueprintCallable, Category = "RyRuntime|DirectorySnapshot")
+    bool Capture(const FString& rootPath, const bool recursive = true);
+
+    /**
+     * Scan the directory again, update the snapshot and return what changed since the last scan.
+     * @param diff The files added, removed or modified
+     * @param onlyChangedDirectories If true, directories whose modification time hasn't changed are not listed again.
+     *        Adding, removing or renaming (including atomic saves) updates a directory's time, but writing into an
+     *        existing file in place usually doesn't, so those edits are only found when this is false.
+     * @return False if the root directory no longer exists, the snapshot is then empty and every file is Removed
+     */
+    UFUNCTION(BlueprintCallable, Category = "RyRuntime|DirectorySnapshot")
+    bool Refresh(FRyDirectorySnapshotDiff& diff, const bool onlyChangedDirectories = true);
+
+    /**
+     * Save the snapshot to a binary file, atomically replacing any existing file.
+     */
+    UFUNCTION(BlueprintCallable, Category = "RyRuntime|DirectorySnapshot")
+    bool SaveToFile(const FString& filePath) const;
+
+    /**
+     * Replace the snapshot with one saved by SaveToFile.
+     * @return False if the file couldn't be read or isn't a snapshot
+     */
+    UFUNCTION(BlueprintCallable, Category = "RyRuntime|DirectorySnapshot")
+    bool LoadFromFile(const FString& filePath);
+
+    /** The directory this snapshot records */
+    UFUNCTION(BlueprintPure, Category = "RyRuntime|DirectorySnapshot")
+    FString GetRootPath() const { return RootPath; }
+
+    /** The number of files in the snapshot */
+    UFUNCTION(BlueprintPure, Category = "RyRuntime|DirectorySnapshot")
+    int32 GetNumFiles() const;
+
+    /** Full paths of every file in the snapshot */
+    UFUNCTION(BlueprintPure, Category = "RyRuntime|DirectorySnapshot")
+    TArray<FString> GetFilePaths() const;
+
+private:
+
+    struct FFileEntry
+    {
+        int64 Size = 0;
+        int64 ModificationTicks = 0;
+    };
+
+    struct FDirEntry
+    {
+        int64 ModificationTicks = 0;
+        TArray<FString> SubDirs;
+        TMap<FString, FFileEntry> Files;
+    };
+
+    // Scan the tree into dirsOut, reusing Dirs entries of unchanged directories when onlyChangedDirectories is set
+    bool Scan(const bool onlyChangedDirectories, TMap<FString, FDirEntry>& dirsOut) const;
+    FString MakeFullPath(const FString& relativeDir, const FString& name) const;
+    void SerializeSnapshot(FArchive& ar);
+
+    FString RootPath;
+    bool Recursive = true;
+
+    // Keyed by directory path relative to RootPath, the root itself is an empty string
+    TMap<FString, FDirEntry> Dirs;
+};
+
 UENUM(BlueprintType)
 enum class ERyNetworkConnectionType : uint8
 {
@@ -111,6 +429,93 @@ public:
     static bool IterateDirectory(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, TArray<FString>& PathsOut, 
                                  RyNativeVisitorSig Visitor = nullptr, RyNativeFileFilterSig Filter = nullptr);
 
+    /**
+    * Iterates files in a directory, scanning directories in parallel across task graph workers. Each sub directory
+    * is launched as its own background task as soon as it is found, so deep or uneven trees keep every worker busy
+    * and no worker is held once its directory is listed. Much faster for large trees with many folders.
+    * NOTE: Visitor and Filter are called from worker threads at the same time, so they must be thread safe.
+    * When nothing halts iteration, PathsOut is the same, and in the same order, as IterateDirectory.
+    * When Visitor halts iteration, directories being scanned at the same time stop at their next path, so PathsOut
+    * may hold fewer paths than IterateDirectory would have collected before halting.
+    * @param DirectoryName The path to the folder to iterate
+    * @param IterateSubFolders Should sub directories be iterated as well?
+    * @param OutType The type of output in PathsOut.
+    * @param PathsOut Paths collected during iteration, based on OutType setting.
+    * @param Visitor (Optional) Called each file or directory found while searching. Return false to halt iteration. Returns true by default.
+    * @param Filter (Optional) Allows filtering of paths which would be added to the PathsOut array. Returns false by default;
+    */
+    static bool IterateDirectoryParallel(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, TArray<FString>& PathsOut,
+                                         RyNativeVisitorSig Visitor = nullptr, RyNativeFileFilterSig Filter = nullptr);
+
+    /**
+    * Iterates files in a directory, collecting the size, times and flags of each path in the same pass.
+    * Cheaper than IterateDirectory followed by GetFileTimeStamp or PathInfo per path, which costs extra file system calls per path.
+    * @param DirectoryName The path to the folder to iterate
+    * @param IterateSubFolders Should sub directories be iterated as well?
+    * @param OutType The type of output in InfosOut.
+    * @param InfosOut Info of the paths collected during iteration, based on OutType setting.
+    * @param Visitor Called each file or directory found while searching. Return false to halt iteration. Returns true by default.
+    * @param Filter Allows filtering of paths which would be added to the InfosOut array. Returns false by default;
+    */
+    UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Directory", DisplayName = "IterateDirectoryStat")
+    static bool RyIterateDirectoryStat(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, TArray<FRyFileInfo>& InfosOut,
+                                       FRyDirectoryVisitor Visitor, FRyFileFilter Filter);
+
+    /**
+    * Native version of IterateDirectoryStat which doesn't rely on dynamic delegates.
+    */
+    static bool IterateDirectoryStat(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, TArray<FRyFileInfo>& InfosOut,
+                                     RyNativeVisitorSig Visitor = nullptr, RyNativeFileFilterSig Filter = nullptr);
+
+    /**
+    * Get the size, times and flags of a file or directory with a single file system call.
+    * @param path The path to the file or directory
+    * @param info The info of the path
+    * @return False if nothing exists at the path
+    */
+    UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|FileSystem")
+    static bool GetFileInfo(const FString& path, FRyFileInfo& info);
+
+    /**
+    * Iterates files in a directory keeping only the paths which pass a filter spec.
+    * The spec is compiled once and matched natively, so unlike a Filter delegate no Blueprint code runs per path.
+    * Excluded directories are never entered. The size and date limits and the file patterns only apply to files.
+    * @param DirectoryName The path to the folder to iterate
+    * @param IterateSubFolders Should sub directories be iterated as well?
+    * @param OutType The type of output in InfosOut.
+    * @param Spec The filter to apply
+    * @param InfosOut Info of the paths which passed the filter, based on OutType setting.
+    * @return False if DirectoryName couldn't be iterated
+    */
+    UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Directory")
+    static bool IterateDirectoryFiltered(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, const FRyFileFilterSpec& Spec,
+                                         TArray<FRyFileInfo>& InfosOut);
+
+    /**
+    * Native version of IterateDirectoryFiltered which takes an already compiled filter, so it can be reused between scans.
+    */
+    static bool IterateDirectoryCompiledFilter(const FString& DirectoryName, const bool IterateSubFolders, ERyIterateDirectoryOut OutType, const class FRyCompiledFileFilter& Filter,
+                                               TArray<FRyFileInfo>& InfosOut);
+
+    /**
+    * Scan a directory into a new snapshot which can later be refreshed to find changed files.
+    * @param outer The owner of the snapshot object
+    * @param rootPath The directory to snapshot
+    * @param recursive If true, sub directories are included
+    * @param success False if rootPath isn't a directory
+    */
+    UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Directory")
+    static URyDirectorySnapshot* CaptureDirectorySnapshot(UObject* outer, const FString& rootPath, const bool recursive, bool& success);
+
+    /**
+    * Load a snapshot saved with URyDirectorySnapshot::SaveToFile. Refresh it to find what changed since it was saved.
+    * @param outer The owner of the snapshot object
+    * @param filePath The snapshot file
+    * @param success False if the file couldn't be read or isn't a snapshot
+    */
+    UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Directory")
+    static URyDirectorySnapshot* LoadDirectorySnapshot(UObject* outer, const FString& filePath, bool& success);
+
 	/**
 	 * Get file time stamp of file at FilePath
 	 * @param filePath - The file path to get a time stamp of
@@ -146,6 +551,65 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|FileSystem")
     static bool DeleteDirectory(const FString& directoryPath, const bool recursive = false);
 
+	/**
+	* Delete a directory and everything in it on a background thread.
+	* The directory is first renamed to a tombstone next to it, so it is gone from directoryPath as soon as this returns
+	* and a new directory can be created there straight away. The tombstone is then deleted in the background.
+	* Tombstones left behind by a crash, quit or cancel are cleaned up the next time the module starts, see SweepDirectoryTombstones.
+	* @param directoryPath - The directory to delete
+	* @param deleteId - The id to pass to GetDirectoryDeleteProgress and CancelDirectoryDelete
+	* @return False if the directory doesn't exist or couldn't be renamed
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|FileSystem")
+	static bool DeleteDirectoryInBackground(const FString& directoryPath, int32& deleteId);
+
+	/**
+	* Native version of DeleteDirectoryInBackground.
+	* @param onComplete - (Optional) Called on the game thread when the delete finishes. False if it failed or was canceled.
+	* @return The delete id, or 0 if the directory doesn't exist or couldn't be renamed
+	*/
+	static int32 DeleteDirectoryAsync(const FString& directoryPath, RyNativeDeleteCompleteSig onComplete = nullptr);
+
+	/**
+	* Latent version of DeleteDirectoryInBackground which completes when the directory has been deleted.
+	* The delete carries on if the latent action is aborted, the directory is already gone for callers at that point.
+	* @param OnProgress - Called each tick on the game thread while the delete runs
+	* @param progress - The final progress
+	* @param success - True if everything was deleted
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|FileSystem", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void DeleteDirectoryLatent(UObject* WorldContextObject, const FString& directoryPath, FRyDeleteProgressDelegate OnProgress, FRyDeleteProgress& progress,
+	                                  bool& success, FLatentActionInfo LatentInfo);
+
+	/**
+	* Get the progress of a background delete.
+	* @return False if the id is unknown or the delete has completed
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|FileSystem")
+	static bool GetDirectoryDeleteProgress(const int32 deleteId, FRyDeleteProgress& progress);
+
+	/**
+	* Stop a background delete. Files already deleted are gone, the rest stay in the tombstone until the next sweep.
+	* @return True if the delete was found
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|FileSystem")
+	static bool CancelDirectoryDelete(const int32 deleteId);
+
+	/**
+	* Delete tombstones left by earlier background deletes which didn't finish.
+	* Every tombstone recorded by DeleteDirectoryInBackground is swept, plus any tombstone found directly inside directories.
+	* Runs automatically in the background when the module starts.
+	* @param directories - (Optional) Extra directories to search for tombstones
+	* @return The number of tombstones queued for deletion
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|FileSystem")
+	static int32 SweepDirectoryTombstones(const TArray<FString>& directories);
+
+	/**
+	* Cancel background deletes and wait for their threads to stop. Called when the module shuts down.
+	*/
+	static void ShutdownDirectoryDeletes();
+
 	/**
 	 * Create a directory, including any parent directories and return true if the directory was created or already existed.
 	 */
@@ -172,6 +636,49 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|FileSystem", meta=(AdvancedDisplay = "2"))
 	static bool MoveFile(const FString& sourcePath, const FString& destinationPath, const bool updateTimeStamp = false);
 
+	/**
+	* Copy a directory and everything in it on background threads, reporting progress each tick.
+	* The source is scanned once, then files are copied in parallel with large buffers and keep their modification times.
+	* If the latent action is aborted, ie its owner is destroyed, the copy stops and the destination is left partially copied.
+	* @param sourceDirectory - The directory to copy
+	* @param destinationDirectory - The directory to copy into, created if it doesn't exist
+	* @param overwrite - If false, files which already exist at the destination fail instead of being replaced
+	* @param OnProgress - Called each tick on the game thread while the copy runs
+	* @param progress - The final progress when the copy completes
+	* @param success - True if every file was copied
+	* @param maxWorkers - The maximum number of files copied at the same time
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|FileSystem", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject", AdvancedDisplay = "maxWorkers"))
+	static void CopyDirectoryTreeLatent(UObject* WorldContextObject, const FString& sourceDirectory, const FString& destinationDirectory, const bool overwrite,
+	                                    FRyFileTransferProgressDelegate OnProgress, FRyFileTransferProgress& progress, bool& success, FLatentActionInfo LatentInfo,
+	                                    const int32 maxWorkers = 4);
+
+	/**
+	* Move a directory and everything in it on background threads, reporting progress each tick.
+	* If the destination doesn't exist the directory is renamed in one step, without scanning it, so progress has no file
+	* counts. Otherwise files are renamed one by one, falling back to copying and deleting when they are on another drive.
+	* Once every file moved, the emptied source directories are removed. Files added to the source during the move are kept.
+	* Parameters match CopyDirectoryTreeLatent.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|FileSystem", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject", AdvancedDisplay = "maxWorkers"))
+	static void MoveDirectoryTreeLatent(UObject* WorldContextObject, const FString& sourceDirectory, const FString& destinationDirectory, const bool overwrite,
+	                                    FRyFileTransferProgressDelegate OnProgress, FRyFileTransferProgress& progress, bool& success, FLatentActionInfo LatentInfo,
+	                                    const int32 maxWorkers = 4);
+
+	/**
+	* Native blocking version of CopyDirectoryTreeLatent. The calling thread copies files alongside the workers.
+	* @return True if every file was copied
+	*/
+	static bool CopyDirectoryTree(const FString& sourceDirectory, const FString& destinationDirectory, const bool overwrite, FRyFileTransferProgress& progress,
+	                              const int32 maxWorkers = 4);
+
+	/**
+	* Native blocking version of MoveDirectoryTreeLatent.
+	* @return True if every file was moved
+	*/
+	static bool MoveDirectoryTree(const FString& sourceDirectory, const FString& destinationDirectory, const bool overwrite, FRyFileTransferProgress& progress,
+	                              const int32 maxWorkers = 4);
+
 	/**
 	 * Does a file at FilePath exist?
 	 * @return True if a file exists at FilePath
@@ -310,6 +817,90 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers")
 	static void CustomNamedStat(const FString& Text, const float Value, const FString& Graph, const FString& Unit);
 
+	/**
+	* Register a named event once and get a handle to begin it with. Cheaper than BeginNamedEvent which converts the
+	* name on every call. Registering the same name again returns the same handle.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers")
+	static FRyNamedEventHandle RegisterNamedEvent(const struct FColor& Color, const FString& Text);
+
+	/**
+	* Begin a named event registered with RegisterNamedEvent. Close it with EndNamedEvent.
+	* See FRyScopedNamedEvent and RY_SCOPED_NAMED_EVENT for native code.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers", DisplayName = "Begin Named Event (Handle)")
+	static void BeginNamedEventHandle(const FRyNamedEventHandle& Handle);
+
+	/**
+	* Register a named custom stat once and get a handle to update it with. Registering the same strings again returns the same handle.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers")
+	static FRyNamedStatHandle RegisterNamedStat(const FString& Text, const FString& Graph, const FString& Unit);
+
+	/** Update a named custom stat registered with RegisterNamedStat */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers", DisplayName = "Custom Named Stat (Handle)")
+	static void CustomNamedStatHandle(const FRyNamedStatHandle& Handle, const float Value);
+
+	/**
+	* Declare a counter which shows in the Counters panel of Unreal Insights, like TRACE_COUNTER but defined at runtime.
+	* The counter is announced to the trace the first time it is set while tracing, so it costs nothing when tracing is off.
+	* Registering the same name again returns the same handle.
+	* @param Name - The counter name shown in Insights
+	* @param IsFloat - True for a float counter, false for an integer counter
+	* @param IsMemory - True to display the value as a memory size
+	* @param Channel - The group the counter belongs to, see SetTraceChannelEnabled
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Trace", meta = (AdvancedDisplay = "2"))
+	static FRyTraceCounterHandle RegisterTraceCounter(const FString& Name, const bool IsFloat = false, const bool IsMemory = false, const FName Channel = NAME_None);
+
+	/** Set an integer trace counter */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Trace")
+	static void SetTraceCounterInt(const FRyTraceCounterHandle& Handle, const int64 Value);
+
+	/** Add to an integer trace counter. The running value is kept even while tracing is off. */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Trace")
+	static void AddTraceCounterInt(const FRyTraceCounterHandle& Handle, const int64 Amount = 1);
+
+	/** Set a float trace counter */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Trace")
+	static void SetTraceCounterFloat(const FRyTraceCounterHandle& Handle, const float Value);
+
+	/**
+	* Declare a named CPU timing scope which shows in the Timing panel of Unreal Insights.
+	* The scope's event type is created in the trace once and cached, so beginning it doesn't send its name every time.
+	* @param Name - The scope name shown in Insights
+	* @param Channel - The group the scope belongs to, see SetTraceChannelEnabled
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Trace", meta = (AdvancedDisplay = "1"))
+	static FRyTraceScopeHandle RegisterTraceScope(const FString& Name, const FName Channel = NAME_None);
+
+	/** Begin a CPU timing scope on the calling thread. Every Begin must be matched by an EndTraceScope on the same thread. */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Trace")
+	static void BeginTraceScope(const FRyTraceScopeHandle& Handle);
+
+	/** End the CPU timing scope most recently begun on the calling thread */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Trace")
+	static void EndTraceScope();
+
+	/** Begin a named timing region in Unreal Insights, which can span frames. Requires Engine 5.1 or greater. */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Trace")
+	static void BeginTraceRegion(const FString& Name);
+
+	/** End a timing region begun with BeginTraceRegion with the same name */
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Trace")
+	static void EndTraceRegion(const FString& Name);
+
+	/**
+	* Enable or disable every trace counter and scope in a channel. Channels are enabled by default.
+	* Disabled counters and scopes return straight away without touching the trace.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Trace")
+	static void SetTraceChannelEnabled(const FName Channel, const bool Enabled);
+
+	/** True if the channel is enabled, see SetTraceChannelEnabled */
+	UFUNCTION(BlueprintPure, Category = "RyRuntime|PlatformHelpers|Trace")
+	static bool IsTraceChannelEnabled(const FName Channel);
+
 	/**
 	* Profiler color stack - this overrides the color for named events with undefined colors (e.g stat namedevents)
 	*/
@@ -343,6 +934,33 @@ public:
 	UFUNCTION(BlueprintPure, Category = "RyRuntime|PlatformHelpers")
 	static int32 NumberOfCoresIncludingHyperthreads();
 
+	/**
+	* Call Body for every index from 0 to num - 1 and gather the returned values into results, then resume.
+	* Body runs in batches on task graph worker threads only if runOnWorkerThreads is true and Body is bound to a function
+	* marked both Pure and Const. Otherwise it runs on the game thread, batchSize indices per frame, so the game never hitches.
+	* Const stops the function setting member variables or calling impure functions on its own object, but nothing stops
+	* it changing other objects, so opting in is a promise that it follows these rules:
+	*  - Only read its inputs and the state of objects which nothing changes while the node runs
+	*  - Never spawn, destroy or modify actors, components or other UObjects, and never call latent or impure nodes
+	*  - No Print String or other logging, the order indices run in isn't defined
+	* Garbage collection waits for each running batch, so keep per-index work small.
+	* @param num - The number of indices to run
+	* @param Body - Returns the value for an index, stored at that index in results
+	* @param results - The value returned by Body for each index
+	* @param batchSize - Indices handed to a worker at a time, or run per frame on the game thread
+	* @param runOnWorkerThreads - Opt in to running a Pure and Const Body on worker threads
+	*/
+	UFUNCTION(BlueprintCallable, Category = "RyRuntime|PlatformHelpers|Threading", meta = (Latent = "", LatentInfo = "LatentInfo", WorldContext = "WorldContextObject", AdvancedDisplay = "batchSize,runOnWorkerThreads"))
+	static void ParallelForLatent(UObject* WorldContextObject, const int32 num, FRyParallelForBody Body, TArray<float>& results, FLatentActionInfo LatentInfo,
+	                              const int32 batchSize = 64, const bool runOnWorkerThreads = false);
+
+	/**
+	* Native version of ParallelForLatent. Returns straight away and runs body for every index from 0 to num - 1 in batches
+	* on task graph worker threads. body must be thread safe, write results into storage sized up front, one slot per index.
+	* @param onComplete - (Optional) Called on the game thread once every index has run
+	*/
+	static void ParallelForAsync(const int32 num, RyNativeParallelForBodySig body, RyNativeParallelForCompleteSig onComplete = nullptr, const int32 batchSize = 64);
+
 	/**
 	* Get the timezone identifier for this platform, or an empty string if the default timezone calculation will work.
 	* @note This should return either an Olson timezone (eg, "America/Los_Angeles") or an offset from GMT/UTC (eg, "GMT-8:00").
@@ -467,6 +1085,32 @@ public:
 	static float GetApplicationDeltaTime(const UObject* WorldContextObject = nullptr);
 };
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * Begins a registered named event and ends it when it goes out of scope.
+ */
+class FRyScopedNamedEvent
+{
+public:
+	explicit FRyScopedNamedEvent(const FRyNamedEventHandle& Handle)
+	{
+		URyRuntimePlatformHelpers::BeginNamedEventHandle(Handle);
+	}
+
+	~FRyScopedNamedEvent()
+	{
+		URyRuntimePlatformHelpers::EndNamedEvent();
+	}
+};
+
+/**
+ * Scoped named event which registers its name the first time the scope runs.
+ * Name must be a string literal, ie RY_SCOPED_NAMED_EVENT("LoadSaveGame", FColor::Green);
+ */
+#define RY_SCOPED_NAMED_EVENT(Name, Color) \
+	static const FRyNamedEventHandle PREPROCESSOR_JOIN(RyNamedEventHandle_, __LINE__) = URyRuntimePlatformHelpers::RegisterNamedEvent(Color, TEXT(Name)); \
+	const FRyScopedNamedEvent PREPROCESSOR_JOIN(RyScopedNamedEvent_, __LINE__)(PREPROCESSOR_JOIN(RyNamedEventHandle_, __LINE__));
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
 */